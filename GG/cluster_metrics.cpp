@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include "ignite/ignite_error.h"
+#include "ignite/impl/cluster/cluster_metrics_aggregator.h"
 #include "ignite/cluster/cluster_metrics.h"
 
 using namespace ignite::common::concurrent;
@@ -124,6 +126,21 @@ namespace ignite
             return impl.Get()->GetCurrentWaitingJobs();
         }
 
+        double ClusterMetrics::GetExecutedJobsRate()
+        {
+            return impl.Get()->GetExecutedJobsRate();
+        }
+
+        double ClusterMetrics::GetExecutedTasksRate()
+        {
+            return impl.Get()->GetExecutedTasksRate();
+        }
+
+        double ClusterMetrics::GetGcFraction()
+        {
+            return impl.Get()->GetGcFraction();
+        }
+
         int64_t ClusterMetrics::GetHeapMemoryCommitted()
         {
             return impl.Get()->GetHeapMemoryCommitted();
@@ -149,11 +166,21 @@ namespace ignite
             return impl.Get()->GetHeapMemoryUsed();
         }
 
+        double ClusterMetrics::GetHeapMemoryUsage()
+        {
+            return impl.Get()->GetHeapMemoryUsage();
+        }
+
         float ClusterMetrics::GetIdleTimePercentage()
         {
             return impl.Get()->GetIdleTimePercentage();
         }
 
+        double ClusterMetrics::GetJobSaturation()
+        {
+            return impl.Get()->GetJobSaturation();
+        }
+
         int64_t ClusterMetrics::GetLastDataVersion()
         {
             return impl.Get()->GetLastDataVersion();
@@ -239,21 +266,41 @@ namespace ignite
             return impl.Get()->GetReceivedBytesCount();
         }
 
+        double ClusterMetrics::GetReceivedBytesRate()
+        {
+            return impl.Get()->GetReceivedBytesRate();
+        }
+
         int32_t ClusterMetrics::GetReceivedMessagesCount()
         {
             return impl.Get()->GetReceivedMessagesCount();
         }
 
+        double ClusterMetrics::GetReceivedMessagesRate()
+        {
+            return impl.Get()->GetReceivedMessagesRate();
+        }
+
         int64_t ClusterMetrics::GetSentBytesCount()
         {
             return impl.Get()->GetSentBytesCount();
         }
 
+        double ClusterMetrics::GetSentBytesRate()
+        {
+            return impl.Get()->GetSentBytesRate();
+        }
+
         int32_t ClusterMetrics::GetSentMessagesCount()
         {
             return impl.Get()->GetSentMessagesCount();
         }
 
+        double ClusterMetrics::GetSentMessagesRate()
+        {
+            return impl.Get()->GetSentMessagesRate();
+        }
+
         Timestamp ClusterMetrics::GetStartTime()
         {
             return impl.Get()->GetStartTime();
@@ -308,5 +355,38 @@ namespace ignite
         {
             return impl.Get()->GetUpTime();
         }
+
+        int64_t ClusterMetrics::GetUpdateInterval()
+        {
+            return impl.Get()->GetUpdateInterval();
+        }
+
+        ClusterMetrics ClusterMetrics::Aggregate(const std::vector<ClusterMetrics>& metrics)
+        {
+            return Aggregate(metrics, std::vector<std::string>(metrics.size()));
+        }
+
+        ClusterMetrics ClusterMetrics::Aggregate(const std::vector<ClusterMetrics>& metrics,
+            const std::vector<std::string>& hosts)
+        {
+            if (metrics.empty())
+                IGNITE_ERROR_1(IgniteError::IGNITE_ERR_ILLEGAL_ARGUMENT, "Metrics to aggregate are not provided");
+
+            if (hosts.size() != metrics.size())
+                IGNITE_ERROR_1(IgniteError::IGNITE_ERR_ILLEGAL_ARGUMENT, "Hosts do not match the metrics to aggregate");
+
+            ClusterMetricsAggregator aggregator;
+
+            aggregator.Reserve(static_cast<int32_t>(metrics.size()));
+
+            for (size_t i = 0; i < metrics.size(); ++i)
+            {
+                SharedPointer<ClusterMetricsImpl> node = metrics[i].impl;
+
+                aggregator.Add(*node.Get(), hosts[i]);
+            }
+
+            return ClusterMetrics(aggregator.Aggregate());
+        }
     }
 }
\ No newline at end of file
@@ -22,6 +22,9 @@
 #ifndef _IGNITE_CLUSTER_CLUSTER_METRICS
 #define _IGNITE_CLUSTER_CLUSTER_METRICS
 
+#include <string>
+#include <vector>
+
 #include <ignite/impl/cluster/cluster_metrics_impl.h>
 
 namespace ignite
@@ -95,7 +98,8 @@ namespace ignite
             /**
              * Get percentage of time this node is busy executing jobs vs.idling.
              *
-             * @return Percentage of time this node is busy executing jobs vs.idling.
+             * @return Percentage of time this node is busy executing jobs vs.idling
+             *     or NaN if the uptime is zero.
              */
             float GetBusyTimePercentage();
 
@@ -176,6 +180,27 @@ namespace ignite
              */
             int32_t GetCurrentWaitingJobs();
 
+            /**
+             * Get number of jobs executed per second since the previous snapshot.
+             *
+             * @return Jobs per second.
+             */
+            double GetExecutedJobsRate();
+
+            /**
+             * Get number of tasks executed per second since the previous snapshot.
+             *
+             * @return Tasks per second.
+             */
+            double GetExecutedTasksRate();
+
+            /**
+             * Get share of the current CPU load spent on garbage collection.
+             *
+             * @return GC fraction in [0, 1] or zero if the CPU load is not known.
+             */
+            double GetGcFraction();
+
             /**
              * Return the amount of heap memory in bytes that is committed for the JVM to use.
              *
@@ -211,13 +236,30 @@ namespace ignite
              */
             int64_t GetHeapMemoryUsed();
 
+            /**
+             * Get ratio of the used heap memory to the maximum one.
+             *
+             * @return Heap memory usage or zero if the maximum is not defined.
+             */
+            double GetHeapMemoryUsage();
+
             /**
              * Get percentage of time this node is idling vs.executing jobs.
              *
-             * @return Percentage of time this node is idling vs.executing jobs.
+             * @return Percentage of time this node is idling vs.executing jobs
+             *     or NaN if the uptime is zero.
              */
             float GetIdleTimePercentage();
 
+            /**
+             * Get number of active and waiting jobs per CPU.
+             *
+             * Values above one mean the node has more jobs than it can run at once.
+             *
+             * @return Job saturation or zero if the number of CPUs is not known.
+             */
+            double GetJobSaturation();
+
             /**
              * In-Memory Data Grid assigns incremental versions to all cache operations.
              *
@@ -337,6 +379,13 @@ namespace ignite
              */
             int64_t GetReceivedBytesCount();
 
+            /**
+             * Get number of bytes received per second since the previous snapshot.
+             *
+             * @return Bytes per second.
+             */
+            double GetReceivedBytesRate();
+
             /**
              * Get received messages count.
              *
@@ -344,6 +393,13 @@ namespace ignite
              */
             int32_t GetReceivedMessagesCount();
 
+            /**
+             * Get number of messages received per second since the previous snapshot.
+             *
+             * @return Messages per second.
+             */
+            double GetReceivedMessagesRate();
+
             /**
              * Get sent bytes count.
              *
@@ -351,6 +407,13 @@ namespace ignite
              */
             int64_t GetSentBytesCount();
 
+            /**
+             * Get number of bytes sent per second since the previous snapshot.
+             *
+             * @return Bytes per second.
+             */
+            double GetSentBytesRate();
+
             /**
              * Get sent messages count.
              *
@@ -358,6 +421,13 @@ namespace ignite
              */
             int32_t GetSentMessagesCount();
 
+            /**
+             * Get number of messages sent per second since the previous snapshot.
+             *
+             * @return Messages per second.
+             */
+            double GetSentMessagesRate();
+
             /**
              * Return the start time of the JVM.
              *
@@ -435,7 +505,43 @@ namespace ignite
              */
             int64_t GetUpTime();
 
+            /**
+             * Get time between the previous snapshot and this one.
+             *
+             * @return Time in milliseconds or zero if there is no previous snapshot.
+             */
+            int64_t GetUpdateInterval();
+
+            /**
+             * Combine metrics of several nodes into the metrics of the group.
+             *
+             * Counters and sizes are summed, maximums and update times take the maximum,
+             * start times take the minimum, averages are averaged and CPU loads are averaged
+             * with the weights of the node CPU counts. Every node is assumed to run on its
+             * own host.
+             *
+             * @param metrics Metrics of the nodes. Should not be empty.
+             * @return Metrics of the group.
+             */
+            static ClusterMetrics Aggregate(const std::vector<ClusterMetrics>& metrics);
+
+            /**
+             * Combine metrics of several nodes into the metrics of the group.
+             *
+             * Same as Aggregate(const std::vector<ClusterMetrics>&), but CPUs of the nodes
+             * which run on one host are counted once.
+             *
+             * @param metrics Metrics of the nodes. Should not be empty.
+             * @param hosts Hosts of the nodes in the same order as the metrics. Nodes with
+             *     equal hosts share CPUs. Empty host is not shared with any other node.
+             * @return Metrics of the group.
+             */
+            static ClusterMetrics Aggregate(const std::vector<ClusterMetrics>& metrics,
+                const std::vector<std::string>& hosts);
+
         private:
+            friend class ClusterMetricsExporter;
+
             common::concurrent::SharedPointer<ignite::impl::cluster::ClusterMetricsImpl> impl;
         };
     }
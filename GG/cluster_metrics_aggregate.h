@@ -0,0 +1,63 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+ /**
+  * @file
+  * Declares ignite::cluster::ClusterMetricsAggregate class.
+  */
+
+#ifndef _IGNITE_CLUSTER_CLUSTER_METRICS_AGGREGATE
+#define _IGNITE_CLUSTER_CLUSTER_METRICS_AGGREGATE
+
+#include <stdint.h>
+
+namespace ignite
+{
+    namespace cluster
+    {
+        /**
+         * Aggregated values of a metric over a time window.
+         */
+        struct ClusterMetricsAggregate
+        {
+            /**
+             * Constructor.
+             */
+            ClusterMetricsAggregate() :
+                count(0), min(0.0), max(0.0), avg(0.0), p95(0.0)
+            {
+                // No-op.
+            }
+
+            /** Number of snapshots in the window. */
+            int32_t count;
+
+            /** Minimum value. */
+            double min;
+
+            /** Maximum value. */
+            double max;
+
+            /** Average value. */
+            double avg;
+
+            /** 95th percentile (nearest rank). */
+            double p95;
+        };
+    }
+}
+
+#endif //_IGNITE_CLUSTER_CLUSTER_METRICS_AGGREGATE
\ No newline at end of file
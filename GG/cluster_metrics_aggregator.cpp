@@ -0,0 +1,330 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+
+#include <ignite/impl/cluster/cluster_metrics_aggregator.h>
+
+namespace
+{
+    /**
+     * Sum values.
+     *
+     * Four independent accumulators break the dependency between additions, so the loop
+     * is pipelined and vectorized.
+     *
+     * @param vals Values.
+     * @param cnt Number of values.
+     * @return Sum.
+     */
+    double Sum(const double* vals, int32_t cnt)
+    {
+        double s0 = 0.0;
+        double s1 = 0.0;
+        double s2 = 0.0;
+        double s3 = 0.0;
+
+        int32_t i = 0;
+
+        for (; i + 4 <= cnt; i += 4)
+        {
+            s0 += vals[i];
+            s1 += vals[i + 1];
+            s2 += vals[i + 2];
+            s3 += vals[i + 3];
+        }
+
+        for (; i < cnt; ++i)
+            s0 += vals[i];
+
+        return (s0 + s1) + (s2 + s3);
+    }
+
+    /**
+     * Sum products of values and weights.
+     *
+     * @param vals Values.
+     * @param weights Weights.
+     * @param cnt Number of values.
+     * @return Sum of products.
+     */
+    double WeightedSum(const double* vals, const double* weights, int32_t cnt)
+    {
+        double s0 = 0.0;
+        double s1 = 0.0;
+        double s2 = 0.0;
+        double s3 = 0.0;
+
+        int32_t i = 0;
+
+        for (; i + 4 <= cnt; i += 4)
+        {
+            s0 += vals[i] * weights[i];
+            s1 += vals[i + 1] * weights[i + 1];
+            s2 += vals[i + 2] * weights[i + 2];
+            s3 += vals[i + 3] * weights[i + 3];
+        }
+
+        for (; i < cnt; ++i)
+            s0 += vals[i] * weights[i];
+
+        return (s0 + s1) + (s2 + s3);
+    }
+
+    /**
+     * Find maximum value.
+     *
+     * @param vals Values.
+     * @param cnt Number of values. Should be positive.
+     * @return Maximum.
+     */
+    double Max(const double* vals, int32_t cnt)
+    {
+        double res = vals[0];
+
+        for (int32_t i = 1; i < cnt; ++i)
+            res = vals[i] > res ? vals[i] : res;
+
+        return res;
+    }
+
+    /**
+     * Find minimum value.
+     *
+     * @param vals Values.
+     * @param cnt Number of values. Should be positive.
+     * @return Minimum.
+     */
+    double Min(const double* vals, int32_t cnt)
+    {
+        double res = vals[0];
+
+        for (int32_t i = 1; i < cnt; ++i)
+            res = vals[i] < res ? vals[i] : res;
+
+        return res;
+    }
+}
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cluster
+        {
+            ClusterMetricsAggregator::ClusterMetricsAggregator()
+            {
+                // No-op.
+            }
+
+            void ClusterMetricsAggregator::Reserve(int32_t cnt)
+            {
+                table.Reserve(cnt);
+                hosts.reserve(cnt);
+            }
+
+            void ClusterMetricsAggregator::Clear()
+            {
+                table.Clear();
+                hosts.clear();
+                hostNodes.clear();
+                hostIndices.clear();
+            }
+
+            void ClusterMetricsAggregator::Add(ClusterMetricsImpl& metrics)
+            {
+                table.Add(metrics);
+
+                hosts.push_back(static_cast<int32_t>(hostNodes.size()));
+                hostNodes.push_back(1);
+            }
+
+            void ClusterMetricsAggregator::Add(ClusterMetricsImpl& metrics, const std::string& host)
+            {
+                if (host.empty())
+                {
+                    Add(metrics);
+
+                    return;
+                }
+
+                table.Add(metrics);
+
+                std::map<std::string, int32_t>::iterator it = hostIndices.find(host);
+
+                if (it == hostIndices.end())
+                {
+                    int32_t idx = static_cast<int32_t>(hostNodes.size());
+
+                    hostIndices.insert(std::make_pair(host, idx));
+
+                    hosts.push_back(idx);
+                    hostNodes.push_back(1);
+                }
+                else
+                {
+                    hosts.push_back(it->second);
+                    ++hostNodes[it->second];
+                }
+            }
+
+            double ClusterMetricsAggregator::Aggregate(ClusterMetricsField::Type field) const
+            {
+                int32_t size = table.GetSize();
+
+                if (!size)
+                    return 0.0;
+
+                const double* vals = table.GetColumn(field);
+
+                if (field == ClusterMetricsField::TOTAL_CPUS)
+                {
+                    std::vector<double> cpus;
+
+                    GetCpuShares(cpus);
+
+                    return Sum(&cpus[0], size);
+                }
+
+                switch (GetAggregation(field))
+                {
+                    case ClusterMetricsAggregation::SUM:
+                        return Sum(vals, size);
+
+                    case ClusterMetricsAggregation::MAX:
+                        return Max(vals, size);
+
+                    case ClusterMetricsAggregation::MIN:
+                        return Min(vals, size);
+
+                    case ClusterMetricsAggregation::AVG_BY_CPUS:
+                    {
+                        std::vector<double> cpus;
+
+                        GetCpuShares(cpus);
+
+                        double totalCpus = Sum(&cpus[0], size);
+
+                        // Nodes which do not report CPUs are averaged evenly.
+                        if (totalCpus > 0.0)
+                            return WeightedSum(vals, &cpus[0], size) / totalCpus;
+
+                        return Sum(vals, size) / size;
+                    }
+
+                    case ClusterMetricsAggregation::COUNT:
+                        return static_cast<double>(size);
+
+                    case ClusterMetricsAggregation::AVG:
+                    default:
+                        return Sum(vals, size) / size;
+                }
+            }
+
+            void ClusterMetricsAggregator::GetCpuShares(std::vector<double>& cpus) const
+            {
+                int32_t size = table.GetSize();
+
+                const double* total = table.GetColumn(ClusterMetricsField::TOTAL_CPUS);
+
+                cpus.resize(size);
+
+                for (int32_t i = 0; i < size; ++i)
+                    cpus[i] = total[i] / hostNodes[hosts[i]];
+            }
+
+            SP_ClusterMetricsImpl ClusterMetricsAggregator::Aggregate() const
+            {
+                if (!table.GetSize())
+                    return SP_ClusterMetricsImpl();
+
+                CompactClusterMetrics compact;
+
+                for (int32_t i = 0; i < ClusterMetricsField::COUNT; ++i)
+                {
+                    ClusterMetricsField::Type field = static_cast<ClusterMetricsField::Type>(i);
+
+                    compact.SetValue(field, Aggregate(field));
+                }
+
+                return SP_ClusterMetricsImpl(new ClusterMetricsImpl(compact));
+            }
+
+            ClusterMetricsAggregation::Type ClusterMetricsAggregator::GetAggregation(ClusterMetricsField::Type field)
+            {
+                switch (field)
+                {
+                    case ClusterMetricsField::LAST_UPDATE_TIME_RAW:
+                    case ClusterMetricsField::LAST_UPDATE_TIME:
+                    case ClusterMetricsField::MAXIMUM_ACTIVE_JOBS:
+                    case ClusterMetricsField::MAXIMUM_WAITING_JOBS:
+                    case ClusterMetricsField::MAXIMUM_REJECTED_JOBS:
+                    case ClusterMetricsField::MAXIMUM_CANCELLED_JOBS:
+                    case ClusterMetricsField::MAXIMUM_JOB_WAIT_TIME:
+                    case ClusterMetricsField::MAXIMUM_JOB_EXECUTE_TIME:
+                    case ClusterMetricsField::UPTIME:
+                    case ClusterMetricsField::MAXIMUM_THREAD_COUNT:
+                    case ClusterMetricsField::LAST_DATA_VERSION:
+                        return ClusterMetricsAggregation::MAX;
+
+                    case ClusterMetricsField::START_TIME:
+                    case ClusterMetricsField::NODE_START_TIME:
+                        return ClusterMetricsAggregation::MIN;
+
+                    case ClusterMetricsField::AVERAGE_ACTIVE_JOBS:
+                    case ClusterMetricsField::AVERAGE_WAITING_JOBS:
+                    case ClusterMetricsField::AVERAGE_REJECTED_JOBS:
+                    case ClusterMetricsField::AVERAGE_CANCELLED_JOBS:
+                    case ClusterMetricsField::CURRENT_JOB_WAIT_TIME:
+                    case ClusterMetricsField::AVERAGE_JOB_WAIT_TIME:
+                    case ClusterMetricsField::CURRENT_JOB_EXECUTE_TIME:
+                    case ClusterMetricsField::AVERAGE_JOB_EXECUTE_TIME:
+                        return ClusterMetricsAggregation::AVG;
+
+                    case ClusterMetricsField::CURRENT_CPU_LOAD:
+                    case ClusterMetricsField::AVERAGE_CPU_LOAD:
+                    case ClusterMetricsField::CURRENT_GC_CPU_LOAD:
+                        return ClusterMetricsAggregation::AVG_BY_CPUS;
+
+                    case ClusterMetricsField::TOTAL_NODES:
+                        return ClusterMetricsAggregation::COUNT;
+
+                    default:
+                        return ClusterMetricsAggregation::SUM;
+                }
+            }
+
+            std::string ClusterMetricsAggregator::MakeHost(const std::vector<std::string>& addrs)
+            {
+                std::vector<std::string> sorted(addrs);
+
+                std::sort(sorted.begin(), sorted.end());
+
+                std::string host;
+
+                for (size_t i = 0; i < sorted.size(); ++i)
+                {
+                    if (i)
+                        host += ',';
+
+                    host += sorted[i];
+                }
+
+                return host;
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,194 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _IGNITE_CLUSTER_CLUSTER_METRICS_AGGREGATOR
+#define _IGNITE_CLUSTER_CLUSTER_METRICS_AGGREGATOR
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <ignite/common/concurrent.h>
+
+#include <ignite/impl/cluster/cluster_metrics_impl.h>
+#include <ignite/impl/cluster/cluster_metrics_table.h>
+#include <ignite/impl/cluster/compact_cluster_metrics.h>
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cluster
+        {
+            /**
+             * Rule of combining values of a metric of several nodes.
+             */
+            struct ClusterMetricsAggregation
+            {
+                enum Type
+                {
+                    /** Sum of the values. */
+                    SUM = 0,
+
+                    /** Maximum value. */
+                    MAX = 1,
+
+                    /** Minimum value. */
+                    MIN = 2,
+
+                    /** Average value. */
+                    AVG = 3,
+
+                    /** Average value weighted by the number of CPUs of the node. */
+                    AVG_BY_CPUS = 4,
+
+                    /** Number of nodes. */
+                    COUNT = 5
+                };
+            };
+
+            /**
+             * Aggregator of the per-node metrics snapshots into the group snapshot.
+             *
+             * Snapshots are stored in a metrics table, so combining a metric is a single pass
+             * over one contiguous column which compilers vectorize. Metrics are combined following the rules of the
+             * platform: counters and sizes are summed, maximums and update times take the
+             * maximum, start times take the minimum, per-node averages are averaged and CPU
+             * loads are averaged with the weights of the node CPU counts.
+             *
+             * CPUs are counted once per host, as the platform does: nodes of one host report
+             * the CPUs of the host, so each of them is given an equal share of those CPUs. The
+             * shares are both summed into the total CPU count and used as the CPU load weights.
+             */
+            class IGNITE_FRIEND_EXPORT ClusterMetricsAggregator
+            {
+            public:
+                /**
+                 * Constructor.
+                 */
+                ClusterMetricsAggregator();
+
+                /**
+                 * Reserve memory for the given number of nodes.
+                 *
+                 * @param cnt Number of nodes.
+                 */
+                void Reserve(int32_t cnt);
+
+                /**
+                 * Remove all snapshots.
+                 */
+                void Clear();
+
+                /**
+                 * Add snapshot of a node which does not share its host with other nodes.
+                 *
+                 * @param metrics Node snapshot.
+                 */
+                void Add(ClusterMetricsImpl& metrics);
+
+                /**
+                 * Add node snapshot.
+                 *
+                 * @param metrics Node snapshot.
+                 * @param host Host of the node. Nodes with equal hosts share CPUs. Empty host
+                 *     is not shared with any other node.
+                 */
+                void Add(ClusterMetricsImpl& metrics, const std::string& host);
+
+                /**
+                 * Get number of added snapshots.
+                 *
+                 * @return Number of snapshots.
+                 */
+                int32_t GetSize() const
+                {
+                    return table.GetSize();
+                }
+
+                /**
+                 * Get column of the metric values.
+                 *
+                 * @param field Metric.
+                 * @return Values in the order the snapshots are added. Timestamps are given
+                 *     in milliseconds.
+                 */
+                const double* GetColumn(ClusterMetricsField::Type field) const
+                {
+                    return table.GetColumn(field);
+                }
+
+                /**
+                 * Combine values of the metric.
+                 *
+                 * @param field Metric.
+                 * @return Combined value or zero if there are no snapshots.
+                 */
+                double Aggregate(ClusterMetricsField::Type field) const;
+
+                /**
+                 * Combine all the metrics into the group snapshot.
+                 *
+                 * @return Group snapshot or invalid pointer if there are no snapshots.
+                 */
+                SP_ClusterMetricsImpl Aggregate() const;
+
+                /**
+                 * Get the rule of combining values of the metric.
+                 *
+                 * @param field Metric.
+                 * @return Rule.
+                 */
+                static ClusterMetricsAggregation::Type GetAggregation(ClusterMetricsField::Type field);
+
+                /**
+                 * Make host of a node from the addresses it is known by.
+                 *
+                 * Nodes of one host are known by the addresses of the host, so nodes with the
+                 * same addresses are taken to run on one host.
+                 *
+                 * @param addrs Node addresses.
+                 * @return Host or empty string if there are no addresses.
+                 */
+                static std::string MakeHost(const std::vector<std::string>& addrs);
+
+            private:
+                IGNITE_NO_COPY_ASSIGNMENT(ClusterMetricsAggregator);
+
+                /**
+                 * Get CPUs of the nodes with the CPUs of every host split between its nodes.
+                 *
+                 * @param cpus Shares of the host CPUs in the order the snapshots are added.
+                 */
+                void GetCpuShares(std::vector<double>& cpus) const;
+
+                /** Snapshots. */
+                ClusterMetricsTable table;
+
+                /** Host index of every snapshot. */
+                std::vector<int32_t> hosts;
+
+                /** Number of snapshots of every host. */
+                std::vector<int32_t> hostNodes;
+
+                /** Host indices by host. */
+                std::map<std::string, int32_t> hostIndices;
+            };
+        }
+    }
+}
+
+#endif //_IGNITE_CLUSTER_CLUSTER_METRICS_AGGREGATOR
\ No newline at end of file
@@ -0,0 +1,134 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef _WIN32
+#   include <windows.h>
+#else
+#   include <time.h>
+#endif
+
+#include <ignite/impl/cluster/cluster_metrics_cache.h>
+
+using namespace ignite::common::concurrent;
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cluster
+        {
+            namespace
+            {
+                /**
+                 * Get current value of the monotonic clock.
+                 *
+                 * @return Time in milliseconds.
+                 */
+                int64_t GetMonotonicTimeMillis()
+                {
+#ifdef _WIN32
+                    return static_cast<int64_t>(GetTickCount64());
+#else
+                    timespec ts;
+                    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+                    return static_cast<int64_t>(ts.tv_sec) * 1000 + ts.tv_nsec / 1000000;
+#endif
+                }
+            }
+
+            ClusterMetricsCache::ClusterMetricsCache() :
+                expireTime(0), ttl(0), hits(0), misses(0)
+            {
+                // No-op.
+            }
+
+            void ClusterMetricsCache::SetTtl(int64_t ttl)
+            {
+                CsLockGuard guard(lock);
+
+                this->ttl = ttl;
+
+                metrics = SP_ClusterMetricsImpl();
+                expireTime = 0;
+            }
+
+            int64_t ClusterMetricsCache::GetTtl()
+            {
+                CsLockGuard guard(lock);
+
+                return ttl;
+            }
+
+            bool ClusterMetricsCache::IsEnabled()
+            {
+                return GetTtl() > 0;
+            }
+
+            SP_ClusterMetricsImpl ClusterMetricsCache::Get()
+            {
+                CsLockGuard guard(lock);
+
+                if (!metrics.IsValid() || GetMonotonicTimeMillis() >= expireTime)
+                    return SP_ClusterMetricsImpl();
+
+                Atomics::IncrementAndGet64(&hits);
+
+                return metrics;
+            }
+
+            SP_ClusterMetricsImpl ClusterMetricsCache::GetLast()
+            {
+                CsLockGuard guard(lock);
+
+                return metrics;
+            }
+
+            SP_ClusterMetricsImpl ClusterMetricsCache::Put(const SP_ClusterMetricsImpl& metrics)
+            {
+                CsLockGuard guard(lock);
+
+                if (ttl > 0)
+                {
+                    Atomics::IncrementAndGet64(&misses);
+
+                    expireTime = GetMonotonicTimeMillis() + ttl;
+                }
+
+                if (!this->metrics.IsValid() ||
+                    this->metrics.Get()->GetLastUpdateTimeRaw() != metrics.Get()->GetLastUpdateTimeRaw())
+                    this->metrics = metrics;
+
+                return this->metrics;
+            }
+
+            CriticalSection& ClusterMetricsCache::GetRefreshLock()
+            {
+                return refreshLock;
+            }
+
+            int64_t ClusterMetricsCache::GetHits()
+            {
+                return Atomics::CompareAndSet64Val(&hits, 0, 0);
+            }
+
+            int64_t ClusterMetricsCache::GetMisses()
+            {
+                return Atomics::CompareAndSet64Val(&misses, 0, 0);
+            }
+        }
+    }
+}
\ No newline at end of file
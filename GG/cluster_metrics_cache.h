@@ -0,0 +1,142 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef _IGNITE_CLUSTER_CLUSTER_METRICS_CACHE
+#define _IGNITE_CLUSTER_CLUSTER_METRICS_CACHE
+
+#include <ignite/common/concurrent.h>
+
+#include <ignite/impl/cluster/cluster_metrics_impl.h>
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cluster
+        {
+            /**
+             * Cache of the cluster group metrics snapshot.
+             *
+             * Snapshot is considered fresh for the configured time to live. When a new snapshot
+             * has the same last update time as the cached one, the cached instance is kept so
+             * callers can detect that nothing has changed by comparing pointers.
+             */
+            class IGNITE_FRIEND_EXPORT ClusterMetricsCache
+            {
+            public:
+                /**
+                 * Constructor. Cache is disabled by default.
+                 */
+                ClusterMetricsCache();
+
+                /**
+                 * Set time to live of the cached snapshot.
+                 *
+                 * @param ttl Time to live in milliseconds. Zero or negative value disables the cache.
+                 */
+                void SetTtl(int64_t ttl);
+
+                /**
+                 * Get time to live of the cached snapshot.
+                 *
+                 * @return Time to live in milliseconds.
+                 */
+                int64_t GetTtl();
+
+                /**
+                 * Check whether the cache is enabled.
+                 *
+                 * @return True if enabled.
+                 */
+                bool IsEnabled();
+
+                /**
+                 * Get cached snapshot if it is still fresh.
+                 *
+                 * @return Cached snapshot or invalid pointer if there is no fresh snapshot.
+                 */
+                SP_ClusterMetricsImpl Get();
+
+                /**
+                 * Get the last snapshot put to the cache regardless of its freshness.
+                 *
+                 * @return Last snapshot or invalid pointer if there is none.
+                 */
+                SP_ClusterMetricsImpl GetLast();
+
+                /**
+                 * Put new snapshot to the cache.
+                 *
+                 * The last snapshot is kept even when the cache is disabled, so rates can be
+                 * derived against it. It serves as a base for incremental updates only while
+                 * the cache is enabled. Counts a cache miss only while the cache is enabled.
+                 *
+                 * @param metrics New snapshot.
+                 * @return Cached snapshot: the old instance if its last update time
+                 *     is the same as of the new one and the new instance otherwise.
+                 */
+                SP_ClusterMetricsImpl Put(const SP_ClusterMetricsImpl& metrics);
+
+                /**
+                 * Get lock to be held while the snapshot is refreshed, so concurrent
+                 * callers wait for a single refresh instead of starting their own.
+                 *
+                 * @return Refresh lock.
+                 */
+                common::concurrent::CriticalSection& GetRefreshLock();
+
+                /**
+                 * Get number of requests served from the cache.
+                 *
+                 * @return Number of cache hits.
+                 */
+                int64_t GetHits();
+
+                /**
+                 * Get number of requests that required a refresh while the cache was enabled.
+                 *
+                 * @return Number of cache misses.
+                 */
+                int64_t GetMisses();
+
+            private:
+                IGNITE_NO_COPY_ASSIGNMENT(ClusterMetricsCache);
+
+                /** Lock guarding the cached snapshot. */
+                common::concurrent::CriticalSection lock;
+
+                /** Refresh lock. */
+                common::concurrent::CriticalSection refreshLock;
+
+                /** Cached snapshot. */
+                SP_ClusterMetricsImpl metrics;
+
+                /** Time when the cached snapshot expires. */
+                int64_t expireTime;
+
+                /** Time to live. */
+                int64_t ttl;
+
+                /** Number of cache hits. */
+                int64_t hits;
+
+                /** Number of cache misses. */
+                int64_t misses;
+            };
+        }
+    }
+}
+
+#endif //_IGNITE_CLUSTER_CLUSTER_METRICS_CACHE
\ No newline at end of file
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite/cluster/cluster_metrics_exporter.h"
+
+using namespace ignite::common::concurrent;
+using namespace ignite::impl::cluster;
+
+namespace ignite
+{
+    namespace cluster
+    {
+        ClusterMetricsExporter::ClusterMetricsExporter(const std::string& prefix, const std::string& label) :
+            impl(new ClusterMetricsExporterImpl(prefix, label))
+        {
+            // No-op.
+        }
+
+        void ClusterMetricsExporter::SetGroups(const std::vector<std::string>& groups)
+        {
+            impl.Get()->SetGroups(groups);
+        }
+
+        int32_t ClusterMetricsExporter::GetSize()
+        {
+            return impl.Get()->GetSize();
+        }
+
+        void ClusterMetricsExporter::Update(int32_t row, const ClusterMetrics& metrics)
+        {
+            SharedPointer<ClusterMetricsImpl> src = metrics.impl;
+
+            impl.Get()->Update(row, *src.Get());
+        }
+
+        void ClusterMetricsExporter::Write()
+        {
+            impl.Get()->Write();
+        }
+
+        const char* ClusterMetricsExporter::GetData()
+        {
+            return impl.Get()->GetData();
+        }
+
+        int32_t ClusterMetricsExporter::GetLength()
+        {
+            return impl.Get()->GetLength();
+        }
+
+        bool ClusterMetricsExporter::WriteTo(int fd)
+        {
+            return impl.Get()->WriteTo(fd);
+        }
+
+        bool ClusterMetricsExporter::WriteHttpResponse(int fd)
+        {
+            return impl.Get()->WriteHttpResponse(fd);
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,131 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+ /**
+  * @file
+  * Declares ignite::cluster::ClusterMetricsExporter class.
+  */
+
+#ifndef _IGNITE_CLUSTER_CLUSTER_METRICS_EXPORTER
+#define _IGNITE_CLUSTER_CLUSTER_METRICS_EXPORTER
+
+#include <string>
+#include <vector>
+
+#include <ignite/cluster/cluster_metrics.h>
+
+#include <ignite/impl/cluster/cluster_metrics_exporter_impl.h>
+
+namespace ignite
+{
+    namespace cluster
+    {
+        /**
+         * Exporter of the metrics of several cluster groups in the OpenMetrics text format.
+         *
+         * Every group is exported as a label value, so one exporter serves all the scraped
+         * groups. The exporter is meant to be kept and reused: metric names and label sets
+         * are prepared once, snapshots are copied into preallocated rows and the output buffer
+         * keeps its size between the scrapes, so a scrape in the steady state does not
+         * allocate memory.
+         *
+         * Typical use is to call Update() for every group as the metrics are received, then
+         * Write() and WriteTo() or WriteHttpResponse() on every scrape.
+         *
+         * Methods are safe to call from different threads, e.g. Update() from the threads
+         * receiving the metrics and the rest from the thread serving scrapes. The exception is
+         * GetData() and GetLength(), which are not synchronized with Write() and should be
+         * called from the thread calling Write().
+         */
+        class IGNITE_IMPORT_EXPORT ClusterMetricsExporter
+        {
+        public:
+            /**
+             * Constructor.
+             *
+             * @param prefix Prefix of the metric names.
+             * @param label Name of the label holding the group name.
+             */
+            ClusterMetricsExporter(const std::string& prefix = "ignite_cluster_", const std::string& label = "group");
+
+            /**
+             * Set names of the groups. Every group gets a row; snapshots set before are dropped.
+             *
+             * @param groups Names of the groups.
+             */
+            void SetGroups(const std::vector<std::string>& groups);
+
+            /**
+             * Get number of groups.
+             *
+             * @return Number of groups.
+             */
+            int32_t GetSize();
+
+            /**
+             * Set metrics of the group. Groups without metrics are not exported.
+             *
+             * @param row Index of the group in the names passed to SetGroups().
+             * @param metrics Metrics.
+             */
+            void Update(int32_t row, const ClusterMetrics& metrics);
+
+            /**
+             * Format metrics of all the groups.
+             */
+            void Write();
+
+            /**
+             * Get metrics formatted by the last call to Write(). Should not be called
+             * concurrently with Write().
+             *
+             * @return Formatted metrics. Not null-terminated.
+             */
+            const char* GetData();
+
+            /**
+             * Get length of the formatted metrics. Should not be called concurrently with
+             * Write().
+             *
+             * @return Length in bytes.
+             */
+            int32_t GetLength();
+
+            /**
+             * Write metrics formatted by the last call to Write() to the file descriptor.
+             *
+             * @param fd File descriptor.
+             * @return True on success and false on the write error.
+             */
+            bool WriteTo(int fd);
+
+            /**
+             * Write metrics formatted by the last call to Write() to the file descriptor as
+             * an HTTP response. Serves a local scrape endpoint when called with the accepted
+             * connection.
+             *
+             * @param fd File descriptor.
+             * @return True on success and false on the write error.
+             */
+            bool WriteHttpResponse(int fd);
+
+        private:
+            common::concurrent::SharedPointer<ignite::impl::cluster::ClusterMetricsExporterImpl> impl;
+        };
+    }
+}
+
+#endif //_IGNITE_CLUSTER_CLUSTER_METRICS_EXPORTER
\ No newline at end of file
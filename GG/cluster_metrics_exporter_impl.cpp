@@ -0,0 +1,520 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef _WIN32
+#   include <io.h>
+#else
+#   include <errno.h>
+#   include <unistd.h>
+#endif
+
+#include <cfloat>
+#include <cstdio>
+#include <cstring>
+
+#include <ignite/impl/cluster/cluster_metrics_exporter_impl.h>
+
+using namespace ignite::common::concurrent;
+using namespace ignite::impl::cluster;
+
+namespace
+{
+    /**
+     * Metrics which are not the fields of the snapshot.
+     */
+    struct DerivedMetric
+    {
+        enum Type
+        {
+            IDLE_TIME_PERCENTAGE = ClusterMetricsField::COUNT,
+
+            BUSY_TIME_PERCENTAGE,
+
+            TOTAL_BUSY_TIME,
+
+            HEAP_MEMORY_USAGE,
+
+            GC_FRACTION,
+
+            JOB_SATURATION,
+
+            UPDATE_INTERVAL,
+
+            EXECUTED_JOBS_RATE,
+
+            EXECUTED_TASKS_RATE,
+
+            SENT_MESSAGES_RATE,
+
+            SENT_BYTES_RATE,
+
+            RECEIVED_MESSAGES_RATE,
+
+            RECEIVED_BYTES_RATE
+        };
+    };
+
+    /**
+     * Exported metric.
+     */
+    struct MetricInfo
+    {
+        /** Field or derived metric. */
+        int32_t metric;
+
+        /** Name without the prefix. */
+        const char* name;
+
+        /** Whether the metric is a counter rather than a gauge. */
+        bool counter;
+    };
+
+    /**
+     * Exported metrics. LAST_UPDATE_TIME_RAW is skipped as it has the same value as
+     * LAST_UPDATE_TIME.
+     */
+    const MetricInfo METRICS[] = {
+        { ClusterMetricsField::LAST_UPDATE_TIME, "last_update_time_milliseconds", false },
+        { ClusterMetricsField::MAXIMUM_ACTIVE_JOBS, "maximum_active_jobs", false },
+        { ClusterMetricsField::CURRENT_ACTIVE_JOBS, "current_active_jobs", false },
+        { ClusterMetricsField::AVERAGE_ACTIVE_JOBS, "average_active_jobs", false },
+        { ClusterMetricsField::MAXIMUM_WAITING_JOBS, "maximum_waiting_jobs", false },
+        { ClusterMetricsField::CURRENT_WAITING_JOBS, "current_waiting_jobs", false },
+        { ClusterMetricsField::AVERAGE_WAITING_JOBS, "average_waiting_jobs", false },
+        { ClusterMetricsField::MAXIMUM_REJECTED_JOBS, "maximum_rejected_jobs", false },
+        { ClusterMetricsField::CURRENT_REJECTED_JOBS, "current_rejected_jobs", false },
+        { ClusterMetricsField::AVERAGE_REJECTED_JOBS, "average_rejected_jobs", false },
+        { ClusterMetricsField::TOTAL_REJECTED_JOBS, "rejected_jobs", true },
+        { ClusterMetricsField::MAXIMUM_CANCELLED_JOBS, "maximum_cancelled_jobs", false },
+        { ClusterMetricsField::CURRENT_CANCELLED_JOBS, "current_cancelled_jobs", false },
+        { ClusterMetricsField::AVERAGE_CANCELLED_JOBS, "average_cancelled_jobs", false },
+        { ClusterMetricsField::TOTAL_CANCELLED_JOBS, "cancelled_jobs", true },
+        { ClusterMetricsField::TOTAL_EXECUTED_JOBS, "executed_jobs", true },
+        { ClusterMetricsField::MAXIMUM_JOB_WAIT_TIME, "maximum_job_wait_time_milliseconds", false },
+        { ClusterMetricsField::CURRENT_JOB_WAIT_TIME, "current_job_wait_time_milliseconds", false },
+        { ClusterMetricsField::AVERAGE_JOB_WAIT_TIME, "average_job_wait_time_milliseconds", false },
+        { ClusterMetricsField::MAXIMUM_JOB_EXECUTE_TIME, "maximum_job_execute_time_milliseconds", false },
+        { ClusterMetricsField::CURRENT_JOB_EXECUTE_TIME, "current_job_execute_time_milliseconds", false },
+        { ClusterMetricsField::AVERAGE_JOB_EXECUTE_TIME, "average_job_execute_time_milliseconds", false },
+        { ClusterMetricsField::TOTAL_EXECUTED_TASKS, "executed_tasks", true },
+        { ClusterMetricsField::TOTAL_IDLE_TIME, "idle_time_milliseconds", true },
+        { ClusterMetricsField::CURRENT_IDLE_TIME, "current_idle_time_milliseconds", false },
+        { ClusterMetricsField::TOTAL_CPUS, "cpus", false },
+        { ClusterMetricsField::CURRENT_CPU_LOAD, "current_cpu_load", false },
+        { ClusterMetricsField::AVERAGE_CPU_LOAD, "average_cpu_load", false },
+        { ClusterMetricsField::CURRENT_GC_CPU_LOAD, "current_gc_cpu_load", false },
+        { ClusterMetricsField::HEAP_MEMORY_INITIALIZED, "heap_memory_initialized_bytes", false },
+        { ClusterMetricsField::HEAP_MEMORY_USED, "heap_memory_used_bytes", false },
+        { ClusterMetricsField::HEAP_MEMORY_COMMITTED, "heap_memory_committed_bytes", false },
+        { ClusterMetricsField::HEAP_MEMORY_MAXIMUM, "heap_memory_maximum_bytes", false },
+        { ClusterMetricsField::HEAP_MEMORY_TOTAL, "heap_memory_total_bytes", false },
+        { ClusterMetricsField::NON_HEAP_MEMORY_INITIALIZED, "non_heap_memory_initialized_bytes", false },
+        { ClusterMetricsField::NON_HEAP_MEMORY_USED, "non_heap_memory_used_bytes", false },
+        { ClusterMetricsField::NON_HEAP_MEMORY_COMMITTED, "non_heap_memory_committed_bytes", false },
+        { ClusterMetricsField::NON_HEAP_MEMORY_MAXIMUM, "non_heap_memory_maximum_bytes", false },
+        { ClusterMetricsField::NON_HEAP_MEMORY_TOTAL, "non_heap_memory_total_bytes", false },
+        { ClusterMetricsField::UPTIME, "uptime_milliseconds", false },
+        { ClusterMetricsField::START_TIME, "start_time_milliseconds", false },
+        { ClusterMetricsField::NODE_START_TIME, "node_start_time_milliseconds", false },
+        { ClusterMetricsField::CURRENT_THREAD_COUNT, "current_threads", false },
+        { ClusterMetricsField::MAXIMUM_THREAD_COUNT, "maximum_threads", false },
+        { ClusterMetricsField::TOTAL_STARTED_THREAD_COUNT, "started_threads", true },
+        { ClusterMetricsField::CURRENT_DAEMON_THREAD_COUNT, "current_daemon_threads", false },
+        { ClusterMetricsField::LAST_DATA_VERSION, "last_data_version", false },
+        { ClusterMetricsField::SENT_MESSAGES_COUNT, "sent_messages", true },
+        { ClusterMetricsField::SENT_BYTES_COUNT, "sent_bytes", true },
+        { ClusterMetricsField::RECEIVED_MESSAGES_COUNT, "received_messages", true },
+        { ClusterMetricsField::RECEIVED_BYTES_COUNT, "received_bytes", true },
+        { ClusterMetricsField::OUTBOUND_MESSAGES_QUEUE_SIZE, "outbound_messages_queue_size", false },
+        { ClusterMetricsField::TOTAL_NODES, "nodes", false },
+        { DerivedMetric::IDLE_TIME_PERCENTAGE, "idle_time_ratio", false },
+        { DerivedMetric::BUSY_TIME_PERCENTAGE, "busy_time_ratio", false },
+        { DerivedMetric::TOTAL_BUSY_TIME, "busy_time_milliseconds", true },
+        { DerivedMetric::HEAP_MEMORY_USAGE, "heap_memory_usage_ratio", false },
+        { DerivedMetric::GC_FRACTION, "gc_cpu_load_ratio", false },
+        { DerivedMetric::JOB_SATURATION, "jobs_per_cpu", false },
+        { DerivedMetric::UPDATE_INTERVAL, "update_interval_milliseconds", false },
+        { DerivedMetric::EXECUTED_JOBS_RATE, "executed_jobs_per_second", false },
+        { DerivedMetric::EXECUTED_TASKS_RATE, "executed_tasks_per_second", false },
+        { DerivedMetric::SENT_MESSAGES_RATE, "sent_messages_per_second", false },
+        { DerivedMetric::SENT_BYTES_RATE, "sent_bytes_per_second", false },
+        { DerivedMetric::RECEIVED_MESSAGES_RATE, "received_messages_per_second", false },
+        { DerivedMetric::RECEIVED_BYTES_RATE, "received_bytes_per_second", false }
+    };
+
+    /** Number of exported metrics. */
+    const int32_t METRICS_COUNT = static_cast<int32_t>(sizeof(METRICS) / sizeof(METRICS[0]));
+
+    /** Initial size of the buffer. */
+    const int32_t INITIAL_BUFFER_SIZE = 64 * 1024;
+
+    /** Number of digits after the decimal point. */
+    const int32_t FRACTION_DIGITS = 9;
+
+    /** Scale of the fraction part. */
+    const uint64_t FRACTION_SCALE = 1000000000;
+
+    /** Numbers starting from this one are formatted with sprintf as they do not fit into uint64_t. */
+    const double MAX_FIXED = 1.8e19;
+
+    /** End of the exposition. */
+    const char END[] = "# EOF\n";
+
+    /** Start of the HTTP response up to the content length. */
+    const char HTTP_HEADER[] =
+        "HTTP/1.0 200 OK\r\n"
+        "Content-Type: application/openmetrics-text; version=1.0.0; charset=utf-8\r\n"
+        "Content-Length: ";
+
+    /**
+     * Get value of the metric.
+     *
+     * @param metrics Raw metrics.
+     * @param derived Derived metrics.
+     * @param metric Field or derived metric.
+     * @return Value. Timestamps are given in milliseconds.
+     */
+    double GetValue(const CompactClusterMetrics& metrics, const ClusterMetricsDerived& derived, int32_t metric)
+    {
+        switch (metric)
+        {
+            case DerivedMetric::IDLE_TIME_PERCENTAGE:
+                return derived.idleTimePercentage;
+
+            case DerivedMetric::BUSY_TIME_PERCENTAGE:
+                return derived.busyTimePercentage;
+
+            case DerivedMetric::TOTAL_BUSY_TIME:
+                return static_cast<double>(metrics.uptime - metrics.totalIdleTime);
+
+            case DerivedMetric::HEAP_MEMORY_USAGE:
+                return derived.heapMemoryUsage;
+
+            case DerivedMetric::GC_FRACTION:
+                return derived.gcFraction;
+
+            case DerivedMetric::JOB_SATURATION:
+                return derived.jobSaturation;
+
+            case DerivedMetric::UPDATE_INTERVAL:
+                return static_cast<double>(derived.updateInterval);
+
+            case DerivedMetric::EXECUTED_JOBS_RATE:
+                return derived.executedJobsRate;
+
+            case DerivedMetric::EXECUTED_TASKS_RATE:
+                return derived.executedTasksRate;
+
+            case DerivedMetric::SENT_MESSAGES_RATE:
+                return derived.sentMessagesRate;
+
+            case DerivedMetric::SENT_BYTES_RATE:
+                return derived.sentBytesRate;
+
+            case DerivedMetric::RECEIVED_MESSAGES_RATE:
+                return derived.receivedMessagesRate;
+
+            case DerivedMetric::RECEIVED_BYTES_RATE:
+                return derived.receivedBytesRate;
+
+            default:
+                return metrics.GetValue(static_cast<ClusterMetricsField::Type>(metric));
+        }
+    }
+
+    /**
+     * Format unsigned integer.
+     *
+     * @param val Value.
+     * @param out Output. Should have room for 20 characters.
+     * @return Number of characters written.
+     */
+    int32_t FormatUnsigned(uint64_t val, char* out)
+    {
+        char digits[20];
+        int32_t cnt = 0;
+
+        do
+        {
+            digits[cnt++] = static_cast<char>('0' + val % 10);
+            val /= 10;
+        }
+        while (val);
+
+        for (int32_t i = 0; i < cnt; ++i)
+            out[i] = digits[cnt - 1 - i];
+
+        return cnt;
+    }
+
+    /**
+     * Write all the bytes to the file descriptor.
+     *
+     * @param fd File descriptor.
+     * @param data Bytes.
+     * @param cnt Number of bytes.
+     * @return True on success and false on the write error.
+     */
+    bool WriteAll(int fd, const char* data, int32_t cnt)
+    {
+        while (cnt > 0)
+        {
+#ifdef _WIN32
+            int written = _write(fd, data, static_cast<unsigned>(cnt));
+#else
+            ssize_t written = write(fd, data, static_cast<size_t>(cnt));
+
+            if (written < 0 && errno == EINTR)
+                continue;
+#endif
+            if (written <= 0)
+                return false;
+
+            data += written;
+            cnt -= static_cast<int32_t>(written);
+        }
+
+        return true;
+    }
+}
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cluster
+        {
+            ClusterMetricsExporterImpl::ClusterMetricsExporterImpl(const std::string& prefix, const std::string& label) :
+                label(label),
+                types(METRICS_COUNT),
+                names(METRICS_COUNT),
+                buf(INITIAL_BUFFER_SIZE),
+                len(0)
+            {
+                for (int32_t i = 0; i < METRICS_COUNT; ++i)
+                {
+                    const MetricInfo& info = METRICS[i];
+
+                    std::string name = prefix + info.name;
+
+                    types[i] = "# TYPE " + name + (info.counter ? " counter\n" : " gauge\n");
+                    names[i] = info.counter ? name + "_total" : name;
+                }
+            }
+
+            void ClusterMetricsExporterImpl::SetGroups(const std::vector<std::string>& groups)
+            {
+                CsLockGuard guard(rowsLock);
+
+                rows.resize(groups.size());
+
+                for (size_t i = 0; i < groups.size(); ++i)
+                {
+                    Row& row = rows[i];
+
+                    row.labels = '{' + label + "=\"";
+
+                    for (std::string::const_iterator it = groups[i].begin(); it != groups[i].end(); ++it)
+                    {
+                        switch (*it)
+                        {
+                            case '\\':
+                                row.labels += "\\\\";
+                                break;
+
+                            case '"':
+                                row.labels += "\\\"";
+                                break;
+
+                            case '\n':
+                                row.labels += "\\n";
+                                break;
+
+                            default:
+                                row.labels += *it;
+                                break;
+                        }
+                    }
+
+                    row.labels += "\"}";
+                    row.set = false;
+                }
+            }
+
+            int32_t ClusterMetricsExporterImpl::GetSize()
+            {
+                CsLockGuard guard(rowsLock);
+
+                return static_cast<int32_t>(rows.size());
+            }
+
+            void ClusterMetricsExporterImpl::Update(int32_t row, ClusterMetricsImpl& metrics)
+            {
+                CsLockGuard guard(rowsLock);
+
+                Row& dst = rows[row];
+
+                metrics.CopyTo(dst.metrics);
+
+                dst.derived = metrics.GetDerived();
+
+                dst.set = true;
+            }
+
+            void ClusterMetricsExporterImpl::Write()
+            {
+                CsLockGuard bufGuard(bufLock);
+                CsLockGuard rowsGuard(rowsLock);
+
+                len = 0;
+
+                // Samples of a metric should go together, so the rows are walked for every metric.
+                for (int32_t i = 0; i < METRICS_COUNT; ++i)
+                {
+                    Append(types[i]);
+
+                    for (std::vector<Row>::const_iterator it = rows.begin(); it != rows.end(); ++it)
+                    {
+                        if (!it->set)
+                            continue;
+
+                        Append(names[i]);
+                        Append(it->labels);
+                        Append(" ", 1);
+                        AppendNumber(GetValue(it->metrics, it->derived, METRICS[i].metric));
+                        Append("\n", 1);
+                    }
+                }
+
+                Append(END, sizeof(END) - 1);
+            }
+
+            bool ClusterMetricsExporterImpl::WriteTo(int fd)
+            {
+                CsLockGuard guard(bufLock);
+
+                return WriteAll(fd, &buf[0], len);
+            }
+
+            bool ClusterMetricsExporterImpl::WriteHttpResponse(int fd)
+            {
+                CsLockGuard guard(bufLock);
+
+                char header[sizeof(HTTP_HEADER) + MAX_NUMBER_LENGTH];
+
+                int32_t headerLen = sizeof(HTTP_HEADER) - 1;
+
+                memcpy(header, HTTP_HEADER, headerLen);
+
+                headerLen += FormatUnsigned(static_cast<uint64_t>(len), header + headerLen);
+
+                memcpy(header + headerLen, "\r\n\r\n", 4);
+                headerLen += 4;
+
+                return WriteAll(fd, header, headerLen) && WriteAll(fd, &buf[0], len);
+            }
+
+            void ClusterMetricsExporterImpl::Append(const char* data, int32_t cnt)
+            {
+                int32_t required = len + cnt;
+
+                if (required > static_cast<int32_t>(buf.size()))
+                {
+                    int32_t size = static_cast<int32_t>(buf.size()) * 2;
+
+                    buf.resize(size > required ? size : required);
+                }
+
+                memcpy(&buf[len], data, cnt);
+                len = required;
+            }
+
+            int32_t ClusterMetricsExporterImpl::FormatNumber(double val, char* out)
+            {
+                if (val != val)
+                {
+                    memcpy(out, "NaN", 3);
+
+                    return 3;
+                }
+
+                if (val > DBL_MAX)
+                {
+                    memcpy(out, "+Inf", 4);
+
+                    return 4;
+                }
+
+                if (val < -DBL_MAX)
+                {
+                    memcpy(out, "-Inf", 4);
+
+                    return 4;
+                }
+
+                int32_t pos = 0;
+
+                if (val < 0)
+                {
+                    out[pos++] = '-';
+                    val = -val;
+                }
+
+                if (val >= MAX_FIXED)
+                    return pos + sprintf(out + pos, "%.17g", val);
+
+                uint64_t integer = static_cast<uint64_t>(val);
+                uint64_t fraction = static_cast<uint64_t>((val - static_cast<double>(integer)) * FRACTION_SCALE + 0.5);
+
+                if (fraction >= FRACTION_SCALE)
+                {
+                    ++integer;
+                    fraction -= FRACTION_SCALE;
+                }
+
+                pos += FormatUnsigned(integer, out + pos);
+
+                if (!fraction)
+                    return pos;
+
+                out[pos++] = '.';
+
+                int32_t digits = FRACTION_DIGITS;
+
+                while (fraction % 10 == 0)
+                {
+                    fraction /= 10;
+                    --digits;
+                }
+
+                for (int32_t i = digits - 1; i >= 0; --i)
+                {
+                    out[pos + i] = static_cast<char>('0' + fraction % 10);
+                    fraction /= 10;
+                }
+
+                return pos + digits;
+            }
+
+            void ClusterMetricsExporterImpl::AppendNumber(double val)
+            {
+                char num[MAX_NUMBER_LENGTH];
+
+                Append(num, FormatNumber(val, num));
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,214 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _IGNITE_CLUSTER_CLUSTER_METRICS_EXPORTER_IMPL
+#define _IGNITE_CLUSTER_CLUSTER_METRICS_EXPORTER_IMPL
+
+#include <string>
+#include <vector>
+
+#include <ignite/common/concurrent.h>
+
+#include <ignite/impl/cluster/cluster_metrics_impl.h>
+#include <ignite/impl/cluster/compact_cluster_metrics.h>
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cluster
+        {
+            /**
+             * Exporter of the metrics of several cluster groups in the OpenMetrics text format.
+             *
+             * Everything that depends only on the set of groups is prepared in advance: metric
+             * names with the TYPE lines and the label sets of the groups. Snapshots are copied
+             * into preallocated rows and formatted into a reusable buffer with the hand-written
+             * number formatting, so a scrape allocates memory only while the buffer grows to its
+             * steady size.
+             *
+             * Rows and the buffer are guarded by separate locks, so Update() called as the
+             * metrics arrive waits for Write() formatting the rows, but not for WriteTo() or
+             * WriteHttpResponse() sending the buffer to a slow client.
+             */
+            class IGNITE_FRIEND_EXPORT ClusterMetricsExporterImpl
+            {
+            public:
+                /** Maximum length of a formatted number. */
+                static const int32_t MAX_NUMBER_LENGTH = 32;
+
+                /**
+                 * Constructor.
+                 *
+                 * @param prefix Prefix of the metric names.
+                 * @param label Name of the label holding the group name.
+                 */
+                ClusterMetricsExporterImpl(const std::string& prefix, const std::string& label);
+
+                /**
+                 * Set names of the groups. Every group gets a row; values of the rows are
+                 * reset.
+                 *
+                 * @param groups Names of the groups.
+                 */
+                void SetGroups(const std::vector<std::string>& groups);
+
+                /**
+                 * Get number of groups.
+                 *
+                 * @return Number of groups.
+                 */
+                int32_t GetSize();
+
+                /**
+                 * Set snapshot of the group.
+                 *
+                 * @param row Index of the group.
+                 * @param metrics Snapshot.
+                 */
+                void Update(int32_t row, ClusterMetricsImpl& metrics);
+
+                /**
+                 * Format metrics of all the groups with a snapshot into the buffer.
+                 */
+                void Write();
+
+                /**
+                 * Get formatted metrics. Not synchronized with Write().
+                 *
+                 * @return Formatted metrics. Valid until the next call to Write().
+                 */
+                const char* GetData() const
+                {
+                    return &buf[0];
+                }
+
+                /**
+                 * Get length of the formatted metrics. Not synchronized with Write().
+                 *
+                 * @return Length in bytes.
+                 */
+                int32_t GetLength() const
+                {
+                    return len;
+                }
+
+                /**
+                 * Write formatted metrics to the file descriptor.
+                 *
+                 * @param fd File descriptor.
+                 * @return True on success and false on the write error.
+                 */
+                bool WriteTo(int fd);
+
+                /**
+                 * Write formatted metrics to the file descriptor as an HTTP response, e.g. to
+                 * the accepted connection of a local scrape endpoint.
+                 *
+                 * @param fd File descriptor.
+                 * @return True on success and false on the write error.
+                 */
+                bool WriteHttpResponse(int fd);
+
+                /**
+                 * Format number. Integers are written exactly, other numbers get at most nine
+                 * digits after the decimal point. Numbers too large for the exact integer
+                 * formatting are written with sprintf.
+                 *
+                 * @param val Value.
+                 * @param out Output. Should have room for MAX_NUMBER_LENGTH characters.
+                 * @return Number of characters written.
+                 */
+                static int32_t FormatNumber(double val, char* out);
+
+            private:
+                IGNITE_NO_COPY_ASSIGNMENT(ClusterMetricsExporterImpl);
+
+                /**
+                 * Snapshot of a group.
+                 */
+                struct Row
+                {
+                    /** Label set of the group. */
+                    std::string labels;
+
+                    /** Whether the snapshot is set. */
+                    bool set;
+
+                    /** Raw metrics. */
+                    CompactClusterMetrics metrics;
+
+                    /** Derived metrics. */
+                    ClusterMetricsDerived derived;
+                };
+
+                /**
+                 * Append bytes to the buffer.
+                 *
+                 * @param data Bytes.
+                 * @param cnt Number of bytes.
+                 */
+                void Append(const char* data, int32_t cnt);
+
+                /**
+                 * Append string to the buffer.
+                 *
+                 * @param str String.
+                 */
+                void Append(const std::string& str)
+                {
+                    Append(str.data(), static_cast<int32_t>(str.size()));
+                }
+
+                /**
+                 * Append formatted number to the buffer.
+                 *
+                 * @param val Number.
+                 */
+                void AppendNumber(double val);
+
+                /** Label name. */
+                std::string label;
+
+                /** TYPE lines by metric. */
+                std::vector<std::string> types;
+
+                /** Sample names by metric. */
+                std::vector<std::string> names;
+
+                /** Rows lock. */
+                common::concurrent::CriticalSection rowsLock;
+
+                /** Rows by group. */
+                std::vector<Row> rows;
+
+                /** Buffer lock. Taken before the rows lock. */
+                common::concurrent::CriticalSection bufLock;
+
+                /** Buffer. */
+                std::vector<char> buf;
+
+                /** Length of the formatted metrics. */
+                int32_t len;
+            };
+
+            /* Shared pointer. */
+            typedef common::concurrent::SharedPointer<ClusterMetricsExporterImpl> SP_ClusterMetricsExporterImpl;
+        }
+    }
+}
+
+#endif //_IGNITE_CLUSTER_CLUSTER_METRICS_EXPORTER_IMPL
\ No newline at end of file
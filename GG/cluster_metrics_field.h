@@ -0,0 +1,101 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+ /**
+  * @file
+  * Declares ignite::cluster::ClusterMetricsField class.
+  */
+
+#ifndef _IGNITE_CLUSTER_CLUSTER_METRICS_FIELD
+#define _IGNITE_CLUSTER_CLUSTER_METRICS_FIELD
+
+namespace ignite
+{
+    namespace cluster
+    {
+        /**
+         * Cluster metrics fields.
+         *
+         * Values are indices of the fields in the order the platform writes them. They are also
+         * used as bit numbers in the mask of an incremental metrics update.
+         */
+        struct ClusterMetricsField
+        {
+            enum Type
+            {
+                LAST_UPDATE_TIME_RAW = 0,
+                LAST_UPDATE_TIME = 1,
+                MAXIMUM_ACTIVE_JOBS = 2,
+                CURRENT_ACTIVE_JOBS = 3,
+                AVERAGE_ACTIVE_JOBS = 4,
+                MAXIMUM_WAITING_JOBS = 5,
+                CURRENT_WAITING_JOBS = 6,
+                AVERAGE_WAITING_JOBS = 7,
+                MAXIMUM_REJECTED_JOBS = 8,
+                CURRENT_REJECTED_JOBS = 9,
+                AVERAGE_REJECTED_JOBS = 10,
+                TOTAL_REJECTED_JOBS = 11,
+                MAXIMUM_CANCELLED_JOBS = 12,
+                CURRENT_CANCELLED_JOBS = 13,
+                AVERAGE_CANCELLED_JOBS = 14,
+                TOTAL_CANCELLED_JOBS = 15,
+                TOTAL_EXECUTED_JOBS = 16,
+                MAXIMUM_JOB_WAIT_TIME = 17,
+                CURRENT_JOB_WAIT_TIME = 18,
+                AVERAGE_JOB_WAIT_TIME = 19,
+                MAXIMUM_JOB_EXECUTE_TIME = 20,
+                CURRENT_JOB_EXECUTE_TIME = 21,
+                AVERAGE_JOB_EXECUTE_TIME = 22,
+                TOTAL_EXECUTED_TASKS = 23,
+                TOTAL_IDLE_TIME = 24,
+                CURRENT_IDLE_TIME = 25,
+                TOTAL_CPUS = 26,
+                CURRENT_CPU_LOAD = 27,
+                AVERAGE_CPU_LOAD = 28,
+                CURRENT_GC_CPU_LOAD = 29,
+                HEAP_MEMORY_INITIALIZED = 30,
+                HEAP_MEMORY_USED = 31,
+                HEAP_MEMORY_COMMITTED = 32,
+                HEAP_MEMORY_MAXIMUM = 33,
+                HEAP_MEMORY_TOTAL = 34,
+                NON_HEAP_MEMORY_INITIALIZED = 35,
+                NON_HEAP_MEMORY_USED = 36,
+                NON_HEAP_MEMORY_COMMITTED = 37,
+                NON_HEAP_MEMORY_MAXIMUM = 38,
+                NON_HEAP_MEMORY_TOTAL = 39,
+                UPTIME = 40,
+                START_TIME = 41,
+                NODE_START_TIME = 42,
+                CURRENT_THREAD_COUNT = 43,
+                MAXIMUM_THREAD_COUNT = 44,
+                TOTAL_STARTED_THREAD_COUNT = 45,
+                CURRENT_DAEMON_THREAD_COUNT = 46,
+                LAST_DATA_VERSION = 47,
+                SENT_MESSAGES_COUNT = 48,
+                SENT_BYTES_COUNT = 49,
+                RECEIVED_MESSAGES_COUNT = 50,
+                RECEIVED_BYTES_COUNT = 51,
+                OUTBOUND_MESSAGES_QUEUE_SIZE = 52,
+                TOTAL_NODES = 53,
+
+                /** Number of fields. */
+                COUNT = 54
+            };
+        };
+    }
+}
+
+#endif //_IGNITE_CLUSTER_CLUSTER_METRICS_FIELD
\ No newline at end of file
@@ -0,0 +1,169 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+
+#include <ignite/impl/cluster/cluster_metrics_history.h>
+
+using namespace ignite::common::concurrent;
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cluster
+        {
+            ClusterMetricsHistory::ClusterMetricsHistory() :
+                head(0), size(0)
+            {
+                // No-op.
+            }
+
+            void ClusterMetricsHistory::SetCapacity(int32_t capacity)
+            {
+                CsLockGuard guard(lock);
+
+                std::vector<CompactClusterMetrics>(capacity > 0 ? capacity : 0).swap(ring);
+
+                head = 0;
+                size = 0;
+
+                values.clear();
+                values.reserve(ring.size());
+            }
+
+            int32_t ClusterMetricsHistory::GetCapacity()
+            {
+                CsLockGuard guard(lock);
+
+                return static_cast<int32_t>(ring.size());
+            }
+
+            int32_t ClusterMetricsHistory::GetSize()
+            {
+                CsLockGuard guard(lock);
+
+                return size;
+            }
+
+            void ClusterMetricsHistory::Add(ClusterMetricsImpl& metrics)
+            {
+                CsLockGuard guard(lock);
+
+                if (ring.empty())
+                    return;
+
+                if (size > 0 && metrics.GetLastUpdateTimeRaw() <= GetByAge(0).hot.lastUpdateTimeRaw)
+                    return;
+
+                metrics.CopyTo(ring[head]);
+
+                head = (head + 1) % static_cast<int32_t>(ring.size());
+
+                if (size < static_cast<int32_t>(ring.size()))
+                    ++size;
+            }
+
+            ClusterMetricsAggregate ClusterMetricsHistory::GetAggregate(ClusterMetricsField::Type field, int64_t window)
+            {
+                CsLockGuard guard(lock);
+
+                ClusterMetricsAggregate res;
+
+                int32_t cnt = GetWindowSize(window);
+
+                if (cnt == 0)
+                    return res;
+
+                values.clear();
+
+                double sum = 0.0;
+
+                for (int32_t i = 0; i < cnt; ++i)
+                {
+                    double val = GetByAge(i).GetValue(field);
+
+                    if (i == 0 || val < res.min)
+                        res.min = val;
+
+                    if (i == 0 || val > res.max)
+                        res.max = val;
+
+                    sum += val;
+
+                    values.push_back(val);
+                }
+
+                // Nearest rank: the smallest value not less than 95% of the values.
+                int32_t rank = static_cast<int32_t>((static_cast<int64_t>(cnt) * 95 + 99) / 100) - 1;
+
+                std::nth_element(values.begin(), values.begin() + rank, values.end());
+
+                res.count = cnt;
+                res.avg = sum / cnt;
+                res.p95 = values[rank];
+
+                return res;
+            }
+
+            double ClusterMetricsHistory::GetRate(ClusterMetricsField::Type field, int64_t window)
+            {
+                CsLockGuard guard(lock);
+
+                int32_t cnt = GetWindowSize(window);
+
+                if (cnt < 2)
+                    return 0.0;
+
+                const CompactClusterMetrics& newest = GetByAge(0);
+                const CompactClusterMetrics& oldest = GetByAge(cnt - 1);
+
+                int64_t elapsed = newest.hot.lastUpdateTimeRaw - oldest.hot.lastUpdateTimeRaw;
+
+                double newestVal = newest.GetValue(field);
+                double oldestVal = oldest.GetValue(field);
+
+                // Counters start over when the node restarts.
+                if (elapsed <= 0 || newestVal < oldestVal)
+                    return 0.0;
+
+                return (newestVal - oldestVal) * 1000.0 / static_cast<double>(elapsed);
+            }
+
+            int32_t ClusterMetricsHistory::GetWindowSize(int64_t window) const
+            {
+                if (size == 0)
+                    return 0;
+
+                int64_t since = GetByAge(0).hot.lastUpdateTimeRaw - window;
+
+                int32_t cnt = 1;
+
+                while (cnt < size && GetByAge(cnt).hot.lastUpdateTimeRaw >= since)
+                    ++cnt;
+
+                return cnt;
+            }
+
+            const CompactClusterMetrics& ClusterMetricsHistory::GetByAge(int32_t age) const
+            {
+                int32_t capacity = static_cast<int32_t>(ring.size());
+
+                return ring[(head - 1 - age + capacity) % capacity];
+            }
+        }
+    }
+}
\ No newline at end of file
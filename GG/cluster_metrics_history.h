@@ -0,0 +1,144 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _IGNITE_CLUSTER_CLUSTER_METRICS_HISTORY
+#define _IGNITE_CLUSTER_CLUSTER_METRICS_HISTORY
+
+#include <vector>
+
+#include <ignite/common/concurrent.h>
+
+#include <ignite/cluster/cluster_metrics_aggregate.h>
+
+#include <ignite/impl/cluster/cluster_metrics_impl.h>
+#include <ignite/impl/cluster/compact_cluster_metrics.h>
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cluster
+        {
+            using ignite::cluster::ClusterMetricsAggregate;
+
+            /**
+             * History of the cluster metrics snapshots.
+             *
+             * Snapshots are kept in compact form in a ring of fixed capacity, so adding one
+             * takes constant time and never allocates. Aggregates are computed over the
+             * snapshots which are not older than the requested window counting back from
+             * the last update time of the newest snapshot.
+             */
+            class IGNITE_FRIEND_EXPORT ClusterMetricsHistory
+            {
+            public:
+                /**
+                 * Constructor. History is disabled until the capacity is set.
+                 */
+                ClusterMetricsHistory();
+
+                /**
+                 * Set capacity. Collected snapshots are discarded.
+                 *
+                 * @param capacity Maximum number of snapshots to keep. Zero disables the history.
+                 */
+                void SetCapacity(int32_t capacity);
+
+                /**
+                 * Get capacity.
+                 *
+                 * @return Maximum number of snapshots to keep.
+                 */
+                int32_t GetCapacity();
+
+                /**
+                 * Get number of collected snapshots.
+                 *
+                 * @return Number of snapshots.
+                 */
+                int32_t GetSize();
+
+                /**
+                 * Add snapshot. Snapshots that are not newer than the last added one are ignored.
+                 *
+                 * @param metrics Snapshot.
+                 */
+                void Add(ClusterMetricsImpl& metrics);
+
+                /**
+                 * Get aggregated values of the metric over the window.
+                 *
+                 * @param field Metric.
+                 * @param window Window in milliseconds.
+                 * @return Aggregated values. Count is zero if there are no snapshots.
+                 */
+                ClusterMetricsAggregate GetAggregate(ClusterMetricsField::Type field, int64_t window);
+
+                /**
+                 * Get rate of change of the metric over the window.
+                 *
+                 * Meant for counters such as ClusterMetricsField::SENT_BYTES_COUNT. A counter
+                 * which is lower in the newest snapshot than in the oldest one is taken as
+                 * reset, like in ClusterMetricsImpl, and gives zero rather than a negative rate.
+                 *
+                 * @param field Metric.
+                 * @param window Window in milliseconds.
+                 * @return Change per second between the oldest and the newest snapshots in the
+                 *     window, or zero if there are less than two snapshots or the counter has
+                 *     gone back.
+                 */
+                double GetRate(ClusterMetricsField::Type field, int64_t window);
+
+            private:
+                IGNITE_NO_COPY_ASSIGNMENT(ClusterMetricsHistory);
+
+                /**
+                 * Get number of the newest snapshots that fit the window.
+                 * Should be called under the lock.
+                 *
+                 * @param window Window in milliseconds.
+                 * @return Number of snapshots.
+                 */
+                int32_t GetWindowSize(int64_t window) const;
+
+                /**
+                 * Get snapshot by its age. Should be called under the lock.
+                 *
+                 * @param age Zero for the newest snapshot, one for the previous one and so on.
+                 * @return Snapshot.
+                 */
+                const CompactClusterMetrics& GetByAge(int32_t age) const;
+
+                /** Lock. */
+                common::concurrent::CriticalSection lock;
+
+                /** Ring of snapshots. */
+                std::vector<CompactClusterMetrics> ring;
+
+                /** Index where the next snapshot is written. */
+                int32_t head;
+
+                /** Number of snapshots in the ring. */
+                int32_t size;
+
+                /** Buffer used to compute percentiles. */
+                std::vector<double> values;
+            };
+        }
+    }
+}
+
+#endif //_IGNITE_CLUSTER_CLUSTER_METRICS_HISTORY
\ No newline at end of file
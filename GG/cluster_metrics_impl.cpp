@@ -14,6 +14,9 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+#include <limits>
+
 #include <ignite/impl/cluster/cluster_metrics_impl.h>
 
 namespace ignite
@@ -23,6 +26,277 @@ namespace ignite
         namespace cluster
         {
             ClusterMetricsImpl::ClusterMetricsImpl(binary::BinaryReaderImpl& reader)
+            {
+                if (!ReadFixedLayout(*reader.GetStream()))
+                    ReadFieldByField(reader);
+
+                Derive(0);
+            }
+
+            ClusterMetricsImpl::ClusterMetricsImpl(const ClusterMetricsImpl& base, binary::BinaryReaderImpl& reader)
+            {
+                int64_t mask = reader.ReadInt64();
+
+                // Values of unknown fields can not be skipped, since their size is unknown as well.
+                if ((mask >> ClusterMetricsField::COUNT) != 0)
+                {
+                    const char* msg = "Unknown field in the mask of the incremental cluster metrics update.";
+                    throw IgniteError(IgniteError::IGNITE_ERR_BINARY, msg);
+                }
+
+                lastUpdateTimeRaw = IsChanged(mask, ClusterMetricsField::LAST_UPDATE_TIME_RAW) ?
+                    reader.ReadInt64() : base.lastUpdateTimeRaw;
+                lastUpdateTime = IsChanged(mask, ClusterMetricsField::LAST_UPDATE_TIME) ?
+                    reader.ReadTimestamp() : base.lastUpdateTime;
+                maximumActiveJobs = IsChanged(mask, ClusterMetricsField::MAXIMUM_ACTIVE_JOBS) ?
+                    reader.ReadInt32() : base.maximumActiveJobs;
+                currentActiveJobs = IsChanged(mask, ClusterMetricsField::CURRENT_ACTIVE_JOBS) ?
+                    reader.ReadInt32() : base.currentActiveJobs;
+                averageActiveJobs = IsChanged(mask, ClusterMetricsField::AVERAGE_ACTIVE_JOBS) ?
+                    reader.ReadFloat() : base.averageActiveJobs;
+                maximumWaitingJobs = IsChanged(mask, ClusterMetricsField::MAXIMUM_WAITING_JOBS) ?
+                    reader.ReadInt32() : base.maximumWaitingJobs;
+                currentWaitingJobs = IsChanged(mask, ClusterMetricsField::CURRENT_WAITING_JOBS) ?
+                    reader.ReadInt32() : base.currentWaitingJobs;
+                averageWaitingJobs = IsChanged(mask, ClusterMetricsField::AVERAGE_WAITING_JOBS) ?
+                    reader.ReadFloat() : base.averageWaitingJobs;
+                maximumRejectedJobs = IsChanged(mask, ClusterMetricsField::MAXIMUM_REJECTED_JOBS) ?
+                    reader.ReadInt32() : base.maximumRejectedJobs;
+                currentRejectedJobs = IsChanged(mask, ClusterMetricsField::CURRENT_REJECTED_JOBS) ?
+                    reader.ReadInt32() : base.currentRejectedJobs;
+                averageRejectedJobs = IsChanged(mask, ClusterMetricsField::AVERAGE_REJECTED_JOBS) ?
+                    reader.ReadFloat() : base.averageRejectedJobs;
+                totalRejectedJobs = IsChanged(mask, ClusterMetricsField::TOTAL_REJECTED_JOBS) ?
+                    reader.ReadInt32() : base.totalRejectedJobs;
+                maximumCancelledJobs = IsChanged(mask, ClusterMetricsField::MAXIMUM_CANCELLED_JOBS) ?
+                    reader.ReadInt32() : base.maximumCancelledJobs;
+                currentCancelledJobs = IsChanged(mask, ClusterMetricsField::CURRENT_CANCELLED_JOBS) ?
+                    reader.ReadInt32() : base.currentCancelledJobs;
+                averageCancelledJobs = IsChanged(mask, ClusterMetricsField::AVERAGE_CANCELLED_JOBS) ?
+                    reader.ReadFloat() : base.averageCancelledJobs;
+                totalCancelledJobs = IsChanged(mask, ClusterMetricsField::TOTAL_CANCELLED_JOBS) ?
+                    reader.ReadInt32() : base.totalCancelledJobs;
+                totalExecutedJobs = IsChanged(mask, ClusterMetricsField::TOTAL_EXECUTED_JOBS) ?
+                    reader.ReadInt32() : base.totalExecutedJobs;
+                maximumJobWaitTime = IsChanged(mask, ClusterMetricsField::MAXIMUM_JOB_WAIT_TIME) ?
+                    reader.ReadInt64() : base.maximumJobWaitTime;
+                currentJobWaitTime = IsChanged(mask, ClusterMetricsField::CURRENT_JOB_WAIT_TIME) ?
+                    reader.ReadInt64() : base.currentJobWaitTime;
+                averageJobWaitTime = IsChanged(mask, ClusterMetricsField::AVERAGE_JOB_WAIT_TIME) ?
+                    reader.ReadDouble() : base.averageJobWaitTime;
+                maximumJobExecuteTime = IsChanged(mask, ClusterMetricsField::MAXIMUM_JOB_EXECUTE_TIME) ?
+                    reader.ReadInt64() : base.maximumJobExecuteTime;
+                currentJobExecuteTime = IsChanged(mask, ClusterMetricsField::CURRENT_JOB_EXECUTE_TIME) ?
+                    reader.ReadInt64() : base.currentJobExecuteTime;
+                averageJobExecuteTime = IsChanged(mask, ClusterMetricsField::AVERAGE_JOB_EXECUTE_TIME) ?
+                    reader.ReadDouble() : base.averageJobExecuteTime;
+                totalExecutedTasks = IsChanged(mask, ClusterMetricsField::TOTAL_EXECUTED_TASKS) ?
+                    reader.ReadInt32() : base.totalExecutedTasks;
+                totalIdleTime = IsChanged(mask, ClusterMetricsField::TOTAL_IDLE_TIME) ?
+                    reader.ReadInt64() : base.totalIdleTime;
+                currentIdleTime = IsChanged(mask, ClusterMetricsField::CURRENT_IDLE_TIME) ?
+                    reader.ReadInt64() : base.currentIdleTime;
+                totalCpus = IsChanged(mask, ClusterMetricsField::TOTAL_CPUS) ?
+                    reader.ReadInt32() : base.totalCpus;
+                currentCpuLoad = IsChanged(mask, ClusterMetricsField::CURRENT_CPU_LOAD) ?
+                    reader.ReadDouble() : base.currentCpuLoad;
+                averageCpuLoad = IsChanged(mask, ClusterMetricsField::AVERAGE_CPU_LOAD) ?
+                    reader.ReadDouble() : base.averageCpuLoad;
+                currentGcCpuLoad = IsChanged(mask, ClusterMetricsField::CURRENT_GC_CPU_LOAD) ?
+                    reader.ReadDouble() : base.currentGcCpuLoad;
+                heapMemoryInitialized = IsChanged(mask, ClusterMetricsField::HEAP_MEMORY_INITIALIZED) ?
+                    reader.ReadInt64() : base.heapMemoryInitialized;
+                heapMemoryUsed = IsChanged(mask, ClusterMetricsField::HEAP_MEMORY_USED) ?
+                    reader.ReadInt64() : base.heapMemoryUsed;
+                heapMemoryCommitted = IsChanged(mask, ClusterMetricsField::HEAP_MEMORY_COMMITTED) ?
+                    reader.ReadInt64() : base.heapMemoryCommitted;
+                heapMemoryMaximum = IsChanged(mask, ClusterMetricsField::HEAP_MEMORY_MAXIMUM) ?
+                    reader.ReadInt64() : base.heapMemoryMaximum;
+                heapMemoryTotal = IsChanged(mask, ClusterMetricsField::HEAP_MEMORY_TOTAL) ?
+                    reader.ReadInt64() : base.heapMemoryTotal;
+                nonHeapMemoryInitialized = IsChanged(mask, ClusterMetricsField::NON_HEAP_MEMORY_INITIALIZED) ?
+                    reader.ReadInt64() : base.nonHeapMemoryInitialized;
+                nonHeapMemoryUsed = IsChanged(mask, ClusterMetricsField::NON_HEAP_MEMORY_USED) ?
+                    reader.ReadInt64() : base.nonHeapMemoryUsed;
+                nonHeapMemoryCommitted = IsChanged(mask, ClusterMetricsField::NON_HEAP_MEMORY_COMMITTED) ?
+                    reader.ReadInt64() : base.nonHeapMemoryCommitted;
+                nonHeapMemoryMaximum = IsChanged(mask, ClusterMetricsField::NON_HEAP_MEMORY_MAXIMUM) ?
+                    reader.ReadInt64() : base.nonHeapMemoryMaximum;
+                nonHeapMemoryTotal = IsChanged(mask, ClusterMetricsField::NON_HEAP_MEMORY_TOTAL) ?
+                    reader.ReadInt64() : base.nonHeapMemoryTotal;
+                uptime = IsChanged(mask, ClusterMetricsField::UPTIME) ?
+                    reader.ReadInt64() : base.uptime;
+                startTime = IsChanged(mask, ClusterMetricsField::START_TIME) ?
+                    reader.ReadTimestamp() : base.startTime;
+                nodeStartTime = IsChanged(mask, ClusterMetricsField::NODE_START_TIME) ?
+                    reader.ReadTimestamp() : base.nodeStartTime;
+                currentThreadCount = IsChanged(mask, ClusterMetricsField::CURRENT_THREAD_COUNT) ?
+                    reader.ReadInt32() : base.currentThreadCount;
+                maximumThreadCount = IsChanged(mask, ClusterMetricsField::MAXIMUM_THREAD_COUNT) ?
+                    reader.ReadInt32() : base.maximumThreadCount;
+                totalStartedThreadCount = IsChanged(mask, ClusterMetricsField::TOTAL_STARTED_THREAD_COUNT) ?
+                    reader.ReadInt64() : base.totalStartedThreadCount;
+                currentDaemonThreadCount = IsChanged(mask, ClusterMetricsField::CURRENT_DAEMON_THREAD_COUNT) ?
+                    reader.ReadInt32() : base.currentDaemonThreadCount;
+                lastDataVersion = IsChanged(mask, ClusterMetricsField::LAST_DATA_VERSION) ?
+                    reader.ReadInt64() : base.lastDataVersion;
+                sentMessagesCount = IsChanged(mask, ClusterMetricsField::SENT_MESSAGES_COUNT) ?
+                    reader.ReadInt32() : base.sentMessagesCount;
+                sentBytesCount = IsChanged(mask, ClusterMetricsField::SENT_BYTES_COUNT) ?
+                    reader.ReadInt64() : base.sentBytesCount;
+                receivedMessagesCount = IsChanged(mask, ClusterMetricsField::RECEIVED_MESSAGES_COUNT) ?
+                    reader.ReadInt32() : base.receivedMessagesCount;
+                receivedBytesCount = IsChanged(mask, ClusterMetricsField::RECEIVED_BYTES_COUNT) ?
+                    reader.ReadInt64() : base.receivedBytesCount;
+                outboundMessagesQueueSize = IsChanged(mask, ClusterMetricsField::OUTBOUND_MESSAGES_QUEUE_SIZE) ?
+                    reader.ReadInt32() : base.outboundMessagesQueueSize;
+                totalNodes = IsChanged(mask, ClusterMetricsField::TOTAL_NODES) ?
+                    reader.ReadInt32() : base.totalNodes;
+
+                Derive(&base);
+            }
+
+            ClusterMetricsImpl::ClusterMetricsImpl(const CompactClusterMetrics& src)
+            {
+                lastUpdateTimeRaw = src.hot.lastUpdateTimeRaw;
+                currentCpuLoad = src.hot.currentCpuLoad;
+                currentGcCpuLoad = src.hot.currentGcCpuLoad;
+                heapMemoryUsed = src.hot.heapMemoryUsed;
+                heapMemoryMaximum = src.hot.heapMemoryMaximum;
+                currentActiveJobs = src.hot.currentActiveJobs;
+                currentWaitingJobs = src.hot.currentWaitingJobs;
+                currentRejectedJobs = src.hot.currentRejectedJobs;
+                outboundMessagesQueueSize = src.hot.outboundMessagesQueueSize;
+                currentThreadCount = src.hot.currentThreadCount;
+                totalCpus = src.hot.totalCpus;
+
+                lastUpdateTime = src.GetLastUpdateTime();
+                maximumActiveJobs = src.maximumActiveJobs;
+                averageActiveJobs = src.averageActiveJobs;
+                maximumWaitingJobs = src.maximumWaitingJobs;
+                averageWaitingJobs = src.averageWaitingJobs;
+                maximumRejectedJobs = src.maximumRejectedJobs;
+                averageRejectedJobs = src.averageRejectedJobs;
+                totalRejectedJobs = src.totalRejectedJobs;
+                maximumCancelledJobs = src.maximumCancelledJobs;
+                currentCancelledJobs = src.currentCancelledJobs;
+                averageCancelledJobs = src.averageCancelledJobs;
+                totalCancelledJobs = src.totalCancelledJobs;
+                totalExecutedJobs = src.totalExecutedJobs;
+                maximumJobWaitTime = src.maximumJobWaitTime;
+                currentJobWaitTime = src.currentJobWaitTime;
+                averageJobWaitTime = src.averageJobWaitTime;
+                maximumJobExecuteTime = src.maximumJobExecuteTime;
+                currentJobExecuteTime = src.currentJobExecuteTime;
+                averageJobExecuteTime = src.averageJobExecuteTime;
+                totalExecutedTasks = src.totalExecutedTasks;
+                totalIdleTime = src.totalIdleTime;
+                currentIdleTime = src.currentIdleTime;
+                averageCpuLoad = src.averageCpuLoad;
+                heapMemoryInitialized = src.heapMemoryInitialized;
+                heapMemoryCommitted = src.heapMemoryCommitted;
+                heapMemoryTotal = src.heapMemoryTotal;
+                nonHeapMemoryInitialized = src.nonHeapMemoryInitialized;
+                nonHeapMemoryUsed = src.nonHeapMemoryUsed;
+                nonHeapMemoryCommitted = src.nonHeapMemoryCommitted;
+                nonHeapMemoryMaximum = src.nonHeapMemoryMaximum;
+                nonHeapMemoryTotal = src.nonHeapMemoryTotal;
+                uptime = src.uptime;
+                startTime = src.GetStartTime();
+                nodeStartTime = src.GetNodeStartTime();
+                maximumThreadCount = src.maximumThreadCount;
+                totalStartedThreadCount = src.totalStartedThreadCount;
+                currentDaemonThreadCount = src.currentDaemonThreadCount;
+                lastDataVersion = src.lastDataVersion;
+                sentMessagesCount = src.sentMessagesCount;
+                sentBytesCount = src.sentBytesCount;
+                receivedMessagesCount = src.receivedMessagesCount;
+                receivedBytesCount = src.receivedBytesCount;
+                totalNodes = src.totalNodes;
+
+                Derive(0);
+            }
+
+            bool ClusterMetricsImpl::ReadFixedLayout(interop::InteropInputStream& stream)
+            {
+                typedef ClusterMetricsLayout Layout;
+
+                if (stream.Remaining() < Layout::LENGTH)
+                    return false;
+
+                int32_t pos = stream.Position();
+
+                int8_t data[Layout::LENGTH];
+                stream.ReadInt8Array(data, Layout::LENGTH);
+
+                if (data[Layout::LAST_UPDATE_TIME] != binary::IGNITE_TYPE_TIMESTAMP ||
+                    data[Layout::START_TIME] != binary::IGNITE_TYPE_TIMESTAMP ||
+                    data[Layout::NODE_START_TIME] != binary::IGNITE_TYPE_TIMESTAMP)
+                {
+                    stream.Position(pos);
+
+                    return false;
+                }
+
+                lastUpdateTimeRaw = Layout::ReadAt<int64_t>(data, Layout::LAST_UPDATE_TIME_RAW);
+                lastUpdateTime = Layout::ReadTimestampAt(data, Layout::LAST_UPDATE_TIME);
+                maximumActiveJobs = Layout::ReadAt<int32_t>(data, Layout::MAXIMUM_ACTIVE_JOBS);
+                currentActiveJobs = Layout::ReadAt<int32_t>(data, Layout::CURRENT_ACTIVE_JOBS);
+                averageActiveJobs = Layout::ReadAt<float>(data, Layout::AVERAGE_ACTIVE_JOBS);
+                maximumWaitingJobs = Layout::ReadAt<int32_t>(data, Layout::MAXIMUM_WAITING_JOBS);
+                currentWaitingJobs = Layout::ReadAt<int32_t>(data, Layout::CURRENT_WAITING_JOBS);
+                averageWaitingJobs = Layout::ReadAt<float>(data, Layout::AVERAGE_WAITING_JOBS);
+                maximumRejectedJobs = Layout::ReadAt<int32_t>(data, Layout::MAXIMUM_REJECTED_JOBS);
+                currentRejectedJobs = Layout::ReadAt<int32_t>(data, Layout::CURRENT_REJECTED_JOBS);
+                averageRejectedJobs = Layout::ReadAt<float>(data, Layout::AVERAGE_REJECTED_JOBS);
+                totalRejectedJobs = Layout::ReadAt<int32_t>(data, Layout::TOTAL_REJECTED_JOBS);
+                maximumCancelledJobs = Layout::ReadAt<int32_t>(data, Layout::MAXIMUM_CANCELLED_JOBS);
+                currentCancelledJobs = Layout::ReadAt<int32_t>(data, Layout::CURRENT_CANCELLED_JOBS);
+                averageCancelledJobs = Layout::ReadAt<float>(data, Layout::AVERAGE_CANCELLED_JOBS);
+                totalCancelledJobs = Layout::ReadAt<int32_t>(data, Layout::TOTAL_CANCELLED_JOBS);
+                totalExecutedJobs = Layout::ReadAt<int32_t>(data, Layout::TOTAL_EXECUTED_JOBS);
+                maximumJobWaitTime = Layout::ReadAt<int64_t>(data, Layout::MAXIMUM_JOB_WAIT_TIME);
+                currentJobWaitTime = Layout::ReadAt<int64_t>(data, Layout::CURRENT_JOB_WAIT_TIME);
+                averageJobWaitTime = Layout::ReadAt<double>(data, Layout::AVERAGE_JOB_WAIT_TIME);
+                maximumJobExecuteTime = Layout::ReadAt<int64_t>(data, Layout::MAXIMUM_JOB_EXECUTE_TIME);
+                currentJobExecuteTime = Layout::ReadAt<int64_t>(data, Layout::CURRENT_JOB_EXECUTE_TIME);
+                averageJobExecuteTime = Layout::ReadAt<double>(data, Layout::AVERAGE_JOB_EXECUTE_TIME);
+                totalExecutedTasks = Layout::ReadAt<int32_t>(data, Layout::TOTAL_EXECUTED_TASKS);
+                totalIdleTime = Layout::ReadAt<int64_t>(data, Layout::TOTAL_IDLE_TIME);
+                currentIdleTime = Layout::ReadAt<int64_t>(data, Layout::CURRENT_IDLE_TIME);
+                totalCpus = Layout::ReadAt<int32_t>(data, Layout::TOTAL_CPUS);
+                currentCpuLoad = Layout::ReadAt<double>(data, Layout::CURRENT_CPU_LOAD);
+                averageCpuLoad = Layout::ReadAt<double>(data, Layout::AVERAGE_CPU_LOAD);
+                currentGcCpuLoad = Layout::ReadAt<double>(data, Layout::CURRENT_GC_CPU_LOAD);
+                heapMemoryInitialized = Layout::ReadAt<int64_t>(data, Layout::HEAP_MEMORY_INITIALIZED);
+                heapMemoryUsed = Layout::ReadAt<int64_t>(data, Layout::HEAP_MEMORY_USED);
+                heapMemoryCommitted = Layout::ReadAt<int64_t>(data, Layout::HEAP_MEMORY_COMMITTED);
+                heapMemoryMaximum = Layout::ReadAt<int64_t>(data, Layout::HEAP_MEMORY_MAXIMUM);
+                heapMemoryTotal = Layout::ReadAt<int64_t>(data, Layout::HEAP_MEMORY_TOTAL);
+                nonHeapMemoryInitialized = Layout::ReadAt<int64_t>(data, Layout::NON_HEAP_MEMORY_INITIALIZED);
+                nonHeapMemoryUsed = Layout::ReadAt<int64_t>(data, Layout::NON_HEAP_MEMORY_USED);
+                nonHeapMemoryCommitted = Layout::ReadAt<int64_t>(data, Layout::NON_HEAP_MEMORY_COMMITTED);
+                nonHeapMemoryMaximum = Layout::ReadAt<int64_t>(data, Layout::NON_HEAP_MEMORY_MAXIMUM);
+                nonHeapMemoryTotal = Layout::ReadAt<int64_t>(data, Layout::NON_HEAP_MEMORY_TOTAL);
+                uptime = Layout::ReadAt<int64_t>(data, Layout::UPTIME);
+                startTime = Layout::ReadTimestampAt(data, Layout::START_TIME);
+                nodeStartTime = Layout::ReadTimestampAt(data, Layout::NODE_START_TIME);
+                currentThreadCount = Layout::ReadAt<int32_t>(data, Layout::CURRENT_THREAD_COUNT);
+                maximumThreadCount = Layout::ReadAt<int32_t>(data, Layout::MAXIMUM_THREAD_COUNT);
+                totalStartedThreadCount = Layout::ReadAt<int64_t>(data, Layout::TOTAL_STARTED_THREAD_COUNT);
+                currentDaemonThreadCount = Layout::ReadAt<int32_t>(data, Layout::CURRENT_DAEMON_THREAD_COUNT);
+                lastDataVersion = Layout::ReadAt<int64_t>(data, Layout::LAST_DATA_VERSION);
+                sentMessagesCount = Layout::ReadAt<int32_t>(data, Layout::SENT_MESSAGES_COUNT);
+                sentBytesCount = Layout::ReadAt<int64_t>(data, Layout::SENT_BYTES_COUNT);
+                receivedMessagesCount = Layout::ReadAt<int32_t>(data, Layout::RECEIVED_MESSAGES_COUNT);
+                receivedBytesCount = Layout::ReadAt<int64_t>(data, Layout::RECEIVED_BYTES_COUNT);
+                outboundMessagesQueueSize = Layout::ReadAt<int32_t>(data, Layout::OUTBOUND_MESSAGES_QUEUE_SIZE);
+                totalNodes = Layout::ReadAt<int32_t>(data, Layout::TOTAL_NODES);
+
+                return true;
+            }
+
+            void ClusterMetricsImpl::ReadFieldByField(binary::BinaryReaderImpl& reader)
             {
                 lastUpdateTimeRaw = reader.ReadInt64();
                 lastUpdateTime = reader.ReadTimestamp();
@@ -129,7 +403,7 @@ namespace ignite
 
             float ClusterMetricsImpl::GetBusyTimePercentage()
             {
-                return 1.0f - GetIdleTimePercentage();
+                return derived.busyTimePercentage;
             }
 
             int32_t ClusterMetricsImpl::GetCurrentActiveJobs()
@@ -187,6 +461,21 @@ namespace ignite
                 return currentWaitingJobs;
             }
 
+            double ClusterMetricsImpl::GetExecutedJobsRate()
+            {
+                return derived.executedJobsRate;
+            }
+
+            double ClusterMetricsImpl::GetExecutedTasksRate()
+            {
+                return derived.executedTasksRate;
+            }
+
+            double ClusterMetricsImpl::GetGcFraction()
+            {
+                return derived.gcFraction;
+            }
+
             int64_t ClusterMetricsImpl::GetHeapMemoryCommitted()
             {
                 return heapMemoryCommitted;
@@ -212,9 +501,19 @@ namespace ignite
                 return heapMemoryUsed;
             }
 
+            double ClusterMetricsImpl::GetHeapMemoryUsage()
+            {
+                return derived.heapMemoryUsage;
+            }
+
             float ClusterMetricsImpl::GetIdleTimePercentage()
             {
-                return totalIdleTime / (float)uptime;
+                return derived.idleTimePercentage;
+            }
+
+            double ClusterMetricsImpl::GetJobSaturation()
+            {
+                return derived.jobSaturation;
             }
 
             int64_t ClusterMetricsImpl::GetLastDataVersion()
@@ -227,6 +526,114 @@ namespace ignite
                 return lastUpdateTime;
             }
 
+            int64_t ClusterMetricsImpl::GetLastUpdateTimeRaw()
+            {
+                return lastUpdateTimeRaw;
+            }
+
+            void ClusterMetricsImpl::CopyTo(CompactClusterMetrics& dst)
+            {
+                dst.hot.lastUpdateTimeRaw = lastUpdateTimeRaw;
+                dst.hot.currentCpuLoad = currentCpuLoad;
+                dst.hot.currentGcCpuLoad = currentGcCpuLoad;
+                dst.hot.heapMemoryUsed = heapMemoryUsed;
+                dst.hot.heapMemoryMaximum = heapMemoryMaximum;
+                dst.hot.currentActiveJobs = currentActiveJobs;
+                dst.hot.currentWaitingJobs = currentWaitingJobs;
+                dst.hot.currentRejectedJobs = currentRejectedJobs;
+                dst.hot.outboundMessagesQueueSize = outboundMessagesQueueSize;
+                dst.hot.currentThreadCount = currentThreadCount;
+                dst.hot.totalCpus = totalCpus;
+
+                dst.lastUpdateTimeSeconds = lastUpdateTime.GetSeconds();
+                dst.lastUpdateTimeNanoseconds = lastUpdateTime.GetSecondFraction();
+                dst.maximumActiveJobs = maximumActiveJobs;
+                dst.averageActiveJobs = averageActiveJobs;
+                dst.maximumWaitingJobs = maximumWaitingJobs;
+                dst.averageWaitingJobs = averageWaitingJobs;
+                dst.maximumRejectedJobs = maximumRejectedJobs;
+                dst.averageRejectedJobs = averageRejectedJobs;
+                dst.totalRejectedJobs = totalRejectedJobs;
+                dst.maximumCancelledJobs = maximumCancelledJobs;
+                dst.currentCancelledJobs = currentCancelledJobs;
+                dst.averageCancelledJobs = averageCancelledJobs;
+                dst.totalCancelledJobs = totalCancelledJobs;
+                dst.totalExecutedJobs = totalExecutedJobs;
+                dst.maximumJobWaitTime = maximumJobWaitTime;
+                dst.currentJobWaitTime = currentJobWaitTime;
+                dst.averageJobWaitTime = averageJobWaitTime;
+                dst.maximumJobExecuteTime = maximumJobExecuteTime;
+                dst.currentJobExecuteTime = currentJobExecuteTime;
+                dst.averageJobExecuteTime = averageJobExecuteTime;
+                dst.totalExecutedTasks = totalExecutedTasks;
+                dst.totalIdleTime = totalIdleTime;
+                dst.currentIdleTime = currentIdleTime;
+                dst.averageCpuLoad = averageCpuLoad;
+                dst.heapMemoryInitialized = heapMemoryInitialized;
+                dst.heapMemoryCommitted = heapMemoryCommitted;
+                dst.heapMemoryTotal = heapMemoryTotal;
+                dst.nonHeapMemoryInitialized = nonHeapMemoryInitialized;
+                dst.nonHeapMemoryUsed = nonHeapMemoryUsed;
+                dst.nonHeapMemoryCommitted = nonHeapMemoryCommitted;
+                dst.nonHeapMemoryMaximum = nonHeapMemoryMaximum;
+                dst.nonHeapMemoryTotal = nonHeapMemoryTotal;
+                dst.uptime = uptime;
+                dst.startTimeSeconds = startTime.GetSeconds();
+                dst.startTimeNanoseconds = startTime.GetSecondFraction();
+                dst.nodeStartTimeSeconds = nodeStartTime.GetSeconds();
+                dst.nodeStartTimeNanoseconds = nodeStartTime.GetSecondFraction();
+                dst.maximumThreadCount = maximumThreadCount;
+                dst.totalStartedThreadCount = totalStartedThreadCount;
+                dst.currentDaemonThreadCount = currentDaemonThreadCount;
+                dst.lastDataVersion = lastDataVersion;
+                dst.sentMessagesCount = sentMessagesCount;
+                dst.sentBytesCount = sentBytesCount;
+                dst.receivedMessagesCount = receivedMessagesCount;
+                dst.receivedBytesCount = receivedBytesCount;
+                dst.totalNodes = totalNodes;
+            }
+
+            void ClusterMetricsImpl::Derive(const ClusterMetricsImpl* prev)
+            {
+                derived = ClusterMetricsDerived();
+
+                if (uptime > 0)
+                {
+                    derived.idleTimePercentage = totalIdleTime / static_cast<float>(uptime);
+                    derived.busyTimePercentage = 1.0f - derived.idleTimePercentage;
+                }
+                else
+                {
+                    // Keep what the division of the raw fields gives for a node that just started.
+                    derived.idleTimePercentage = std::numeric_limits<float>::quiet_NaN();
+                    derived.busyTimePercentage = derived.idleTimePercentage;
+                }
+
+                if (heapMemoryMaximum > 0)
+                    derived.heapMemoryUsage = static_cast<double>(heapMemoryUsed) / heapMemoryMaximum;
+
+                // GC load is sampled separately from the CPU load and may briefly exceed it.
+                if (currentCpuLoad > 0)
+                    derived.gcFraction = std::min(currentGcCpuLoad / currentCpuLoad, 1.0);
+
+                if (totalCpus > 0)
+                    derived.jobSaturation = static_cast<double>(currentActiveJobs + currentWaitingJobs) / totalCpus;
+
+                if (!prev || lastUpdateTimeRaw <= prev->lastUpdateTimeRaw)
+                    return;
+
+                derived.updateInterval = lastUpdateTimeRaw - prev->lastUpdateTimeRaw;
+
+                double seconds = derived.updateInterval / 1000.0;
+
+                derived.executedJobsRate = Rate(totalExecutedJobs, prev->totalExecutedJobs, seconds);
+                derived.executedTasksRate = Rate(totalExecutedTasks, prev->totalExecutedTasks, seconds);
+                derived.sentMessagesRate = Rate(sentMessagesCount, prev->sentMessagesCount, seconds);
+                derived.sentBytesRate = Rate(sentBytesCount, prev->sentBytesCount, seconds);
+                derived.receivedMessagesRate = Rate(receivedMessagesCount, prev->receivedMessagesCount, seconds);
+                derived.receivedBytesRate = Rate(receivedBytesCount, prev->receivedBytesCount, seconds);
+            }
+
             int32_t ClusterMetricsImpl::GetMaximumActiveJobs()
             {
                 return maximumActiveJobs;
@@ -302,21 +709,41 @@ namespace ignite
                 return receivedBytesCount;
             }
 
+            double ClusterMetricsImpl::GetReceivedBytesRate()
+            {
+                return derived.receivedBytesRate;
+            }
+
             int32_t ClusterMetricsImpl::GetReceivedMessagesCount()
             {
                 return receivedMessagesCount;
             }
 
+            double ClusterMetricsImpl::GetReceivedMessagesRate()
+            {
+                return derived.receivedMessagesRate;
+            }
+
             int64_t ClusterMetricsImpl::GetSentBytesCount()
             {
                 return sentBytesCount;
             }
 
+            double ClusterMetricsImpl::GetSentBytesRate()
+            {
+                return derived.sentBytesRate;
+            }
+
             int32_t ClusterMetricsImpl::GetSentMessagesCount()
             {
                 return sentMessagesCount;
             }
 
+            double ClusterMetricsImpl::GetSentMessagesRate()
+            {
+                return derived.sentMessagesRate;
+            }
+
             Timestamp ClusterMetricsImpl::GetStartTime()
             {
                 return startTime;
@@ -371,6 +798,11 @@ namespace ignite
             {
                 return uptime;
             }
+
+            int64_t ClusterMetricsImpl::GetUpdateInterval()
+            {
+                return derived.updateInterval;
+            }
         }
     }
 }
\ No newline at end of file
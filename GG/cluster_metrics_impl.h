@@ -17,11 +17,16 @@
 #ifndef _IGNITE_CLUSTER_CLUSTER_METRICS_IMPL
 #define _IGNITE_CLUSTER_CLUSTER_METRICS_IMPL
 
+#include <cstring>
+
 #include <ignite/common/concurrent.h>
 #include <ignite/jni/java.h>
 #include <ignite/guid.h>
 
+#include <ignite/cluster/cluster_metrics_field.h>
+
 #include <ignite/impl/interop/interop_target.h>
+#include <ignite/impl/cluster/compact_cluster_metrics.h>
 
 namespace ignite
 {
@@ -35,6 +40,177 @@ namespace ignite
             /* Shared pointer. */
             typedef common::concurrent::SharedPointer<ClusterMetricsImpl> SP_ClusterMetricsImpl;
 
+            using ignite::cluster::ClusterMetricsField;
+
+            /**
+             * Binary layout of the cluster metrics payload.
+             *
+             * Offsets are given in bytes relative to the start of the payload. Timestamps are
+             * written with a type header and take 13 bytes, all other fields are written raw.
+             */
+            struct ClusterMetricsLayout
+            {
+                enum Type
+                {
+                    LAST_UPDATE_TIME_RAW = 0,
+                    LAST_UPDATE_TIME = LAST_UPDATE_TIME_RAW + 8,
+                    MAXIMUM_ACTIVE_JOBS = LAST_UPDATE_TIME + 13,
+                    CURRENT_ACTIVE_JOBS = MAXIMUM_ACTIVE_JOBS + 4,
+                    AVERAGE_ACTIVE_JOBS = CURRENT_ACTIVE_JOBS + 4,
+                    MAXIMUM_WAITING_JOBS = AVERAGE_ACTIVE_JOBS + 4,
+                    CURRENT_WAITING_JOBS = MAXIMUM_WAITING_JOBS + 4,
+                    AVERAGE_WAITING_JOBS = CURRENT_WAITING_JOBS + 4,
+                    MAXIMUM_REJECTED_JOBS = AVERAGE_WAITING_JOBS + 4,
+                    CURRENT_REJECTED_JOBS = MAXIMUM_REJECTED_JOBS + 4,
+                    AVERAGE_REJECTED_JOBS = CURRENT_REJECTED_JOBS + 4,
+                    TOTAL_REJECTED_JOBS = AVERAGE_REJECTED_JOBS + 4,
+                    MAXIMUM_CANCELLED_JOBS = TOTAL_REJECTED_JOBS + 4,
+                    CURRENT_CANCELLED_JOBS = MAXIMUM_CANCELLED_JOBS + 4,
+                    AVERAGE_CANCELLED_JOBS = CURRENT_CANCELLED_JOBS + 4,
+                    TOTAL_CANCELLED_JOBS = AVERAGE_CANCELLED_JOBS + 4,
+                    TOTAL_EXECUTED_JOBS = TOTAL_CANCELLED_JOBS + 4,
+                    MAXIMUM_JOB_WAIT_TIME = TOTAL_EXECUTED_JOBS + 4,
+                    CURRENT_JOB_WAIT_TIME = MAXIMUM_JOB_WAIT_TIME + 8,
+                    AVERAGE_JOB_WAIT_TIME = CURRENT_JOB_WAIT_TIME + 8,
+                    MAXIMUM_JOB_EXECUTE_TIME = AVERAGE_JOB_WAIT_TIME + 8,
+                    CURRENT_JOB_EXECUTE_TIME = MAXIMUM_JOB_EXECUTE_TIME + 8,
+                    AVERAGE_JOB_EXECUTE_TIME = CURRENT_JOB_EXECUTE_TIME + 8,
+                    TOTAL_EXECUTED_TASKS = AVERAGE_JOB_EXECUTE_TIME + 8,
+                    TOTAL_IDLE_TIME = TOTAL_EXECUTED_TASKS + 4,
+                    CURRENT_IDLE_TIME = TOTAL_IDLE_TIME + 8,
+                    TOTAL_CPUS = CURRENT_IDLE_TIME + 8,
+                    CURRENT_CPU_LOAD = TOTAL_CPUS + 4,
+                    AVERAGE_CPU_LOAD = CURRENT_CPU_LOAD + 8,
+                    CURRENT_GC_CPU_LOAD = AVERAGE_CPU_LOAD + 8,
+                    HEAP_MEMORY_INITIALIZED = CURRENT_GC_CPU_LOAD + 8,
+                    HEAP_MEMORY_USED = HEAP_MEMORY_INITIALIZED + 8,
+                    HEAP_MEMORY_COMMITTED = HEAP_MEMORY_USED + 8,
+                    HEAP_MEMORY_MAXIMUM = HEAP_MEMORY_COMMITTED + 8,
+                    HEAP_MEMORY_TOTAL = HEAP_MEMORY_MAXIMUM + 8,
+                    NON_HEAP_MEMORY_INITIALIZED = HEAP_MEMORY_TOTAL + 8,
+                    NON_HEAP_MEMORY_USED = NON_HEAP_MEMORY_INITIALIZED + 8,
+                    NON_HEAP_MEMORY_COMMITTED = NON_HEAP_MEMORY_USED + 8,
+                    NON_HEAP_MEMORY_MAXIMUM = NON_HEAP_MEMORY_COMMITTED + 8,
+                    NON_HEAP_MEMORY_TOTAL = NON_HEAP_MEMORY_MAXIMUM + 8,
+                    UPTIME = NON_HEAP_MEMORY_TOTAL + 8,
+                    START_TIME = UPTIME + 8,
+                    NODE_START_TIME = START_TIME + 13,
+                    CURRENT_THREAD_COUNT = NODE_START_TIME + 13,
+                    MAXIMUM_THREAD_COUNT = CURRENT_THREAD_COUNT + 4,
+                    TOTAL_STARTED_THREAD_COUNT = MAXIMUM_THREAD_COUNT + 4,
+                    CURRENT_DAEMON_THREAD_COUNT = TOTAL_STARTED_THREAD_COUNT + 8,
+                    LAST_DATA_VERSION = CURRENT_DAEMON_THREAD_COUNT + 4,
+                    SENT_MESSAGES_COUNT = LAST_DATA_VERSION + 8,
+                    SENT_BYTES_COUNT = SENT_MESSAGES_COUNT + 4,
+                    RECEIVED_MESSAGES_COUNT = SENT_BYTES_COUNT + 8,
+                    RECEIVED_BYTES_COUNT = RECEIVED_MESSAGES_COUNT + 4,
+                    OUTBOUND_MESSAGES_QUEUE_SIZE = RECEIVED_BYTES_COUNT + 8,
+                    TOTAL_NODES = OUTBOUND_MESSAGES_QUEUE_SIZE + 4,
+
+                    /** Length of the whole payload in bytes. */
+                    LENGTH = TOTAL_NODES + 4
+                };
+
+                /**
+                 * Read raw value at the given offset.
+                 *
+                 * @param data Payload.
+                 * @param off Field offset.
+                 * @return Value.
+                 */
+                template<typename T>
+                static T ReadAt(const int8_t* data, int32_t off)
+                {
+                    T res;
+
+                    memcpy(&res, data + off, sizeof(res));
+
+                    return res;
+                }
+
+                /**
+                 * Read timestamp at the given offset. Type header is expected to be checked by the caller.
+                 *
+                 * @param data Payload.
+                 * @param off Field offset.
+                 * @return Timestamp.
+                 */
+                static Timestamp ReadTimestampAt(const int8_t* data, int32_t off)
+                {
+                    int64_t milliseconds = ReadAt<int64_t>(data, off + 1);
+                    int32_t nanoseconds = ReadAt<int32_t>(data, off + 1 + 8);
+
+                    return Timestamp(milliseconds / 1000, (milliseconds % 1000) * 1000000 + nanoseconds);
+                }
+            };
+
+            /**
+             * Metrics derived from the raw fields of a snapshot and the previous snapshot.
+             *
+             * Computed once when the snapshot is received. Time percentages are NaN when
+             * the uptime is zero. Rates are zero when there is no previous snapshot, when
+             * the update times do not advance or when a counter goes back, e.g. after the
+             * node restart.
+             */
+            struct ClusterMetricsDerived
+            {
+                /**
+                 * Constructor.
+                 */
+                ClusterMetricsDerived() :
+                    idleTimePercentage(0.0f),
+                    busyTimePercentage(0.0f),
+                    heapMemoryUsage(0.0),
+                    gcFraction(0.0),
+                    jobSaturation(0.0),
+                    updateInterval(0),
+                    executedJobsRate(0.0),
+                    executedTasksRate(0.0),
+                    sentMessagesRate(0.0),
+                    sentBytesRate(0.0),
+                    receivedMessagesRate(0.0),
+                    receivedBytesRate(0.0)
+                {
+                    // No-op.
+                }
+
+                /** Share of the uptime the node spent idling. */
+                float idleTimePercentage;
+
+                /** Share of the uptime the node spent executing jobs. */
+                float busyTimePercentage;
+
+                /** Used to maximum heap memory ratio. */
+                double heapMemoryUsage;
+
+                /** Share of the CPU load spent on garbage collection. */
+                double gcFraction;
+
+                /** Active and waiting jobs per CPU. */
+                double jobSaturation;
+
+                /** Time between the previous snapshot and this one in milliseconds. */
+                int64_t updateInterval;
+
+                /** Jobs executed per second. */
+                double executedJobsRate;
+
+                /** Tasks executed per second. */
+                double executedTasksRate;
+
+                /** Messages sent per second. */
+                double sentMessagesRate;
+
+                /** Bytes sent per second. */
+                double sentBytesRate;
+
+                /** Messages received per second. */
+                double receivedMessagesRate;
+
+                /** Bytes received per second. */
+                double receivedBytesRate;
+            };
+
             /**
              * Cluster metrics implementation.
              */
@@ -48,6 +224,27 @@ namespace ignite
                  */
                 ClusterMetricsImpl(binary::BinaryReaderImpl& reader);
 
+                /**
+                 * Constructor used to apply an incremental update to the existing snapshot.
+                 *
+                 * The update starts with the mask of changed fields, where bit N stands for the
+                 * ClusterMetricsField with index N. It is followed by the values of the changed
+                 * fields in the order they are written in the full payload. Unchanged values are
+                 * taken from the base snapshot.
+                 *
+                 * @param base Base snapshot.
+                 * @param reader Reader positioned at the start of the update.
+                 * @throw IgniteError if the mask has a bit of an unknown field set.
+                 */
+                ClusterMetricsImpl(const ClusterMetricsImpl& base, binary::BinaryReaderImpl& reader);
+
+                /**
+                 * Constructor used to create an instance from the compact representation.
+                 *
+                 * @param src Compact metrics.
+                 */
+                explicit ClusterMetricsImpl(const CompactClusterMetrics& src);
+
                 /**
                  * Get average number of active jobs concurrently executing on the node.
                  *
@@ -100,7 +297,8 @@ namespace ignite
                 /**
                  * Get percentage of time this node is busy executing jobs vs.idling.
                  *
-                 * @return Percentage of time this node is busy executing jobs vs.idling.
+                 * @return Percentage of time this node is busy executing jobs vs.idling
+                 *     or NaN if the uptime is zero.
                  */
                 float GetBusyTimePercentage();
 
@@ -181,6 +379,27 @@ namespace ignite
                  */
                 int32_t GetCurrentWaitingJobs();
 
+                /**
+                 * Get number of jobs executed per second since the previous snapshot.
+                 *
+                 * @return Jobs per second.
+                 */
+                double GetExecutedJobsRate();
+
+                /**
+                 * Get number of tasks executed per second since the previous snapshot.
+                 *
+                 * @return Tasks per second.
+                 */
+                double GetExecutedTasksRate();
+
+                /**
+                 * Get share of the current CPU load spent on garbage collection.
+                 *
+                 * @return GC fraction in [0, 1] or zero if the CPU load is not known.
+                 */
+                double GetGcFraction();
+
                 /**
                  * Return the amount of heap memory in bytes that is committed for the JVM to use.
                  *
@@ -216,13 +435,30 @@ namespace ignite
                  */
                 int64_t GetHeapMemoryUsed();
 
+                /**
+                 * Get ratio of the used heap memory to the maximum one.
+                 *
+                 * @return Heap memory usage or zero if the maximum is not defined.
+                 */
+                double GetHeapMemoryUsage();
+
                 /**
                  * Get percentage of time this node is idling vs.executing jobs.
                  *
-                 * @return Percentage of time this node is idling vs.executing jobs.
+                 * @return Percentage of time this node is idling vs.executing jobs
+                 *     or NaN if the uptime is zero.
                  */
                 float GetIdleTimePercentage();
 
+                /**
+                 * Get number of active and waiting jobs per CPU.
+                 *
+                 * Values above one mean the node has more jobs than it can run at once.
+                 *
+                 * @return Job saturation or zero if the number of CPUs is not known.
+                 */
+                double GetJobSaturation();
+
                 /**
                  * In-Memory Data Grid assigns incremental versions to all cache operations.
                  *
@@ -237,6 +473,39 @@ namespace ignite
                  */
                 Timestamp GetLastUpdateTime();
 
+                /**
+                 * Get last update time of this node metrics in raw format.
+                 *
+                 * @return Last update time of this node metrics in milliseconds.
+                 */
+                int64_t GetLastUpdateTimeRaw();
+
+                /**
+                 * Copy metrics into the compact representation.
+                 *
+                 * @param dst Destination.
+                 */
+                void CopyTo(CompactClusterMetrics& dst);
+
+                /**
+                 * Compute derived metrics against the previous snapshot. Called by the
+                 * constructors; should be called again when the previous snapshot becomes
+                 * known after the construction.
+                 *
+                 * @param prev Previous snapshot of the same node or group. Can be null.
+                 */
+                void Derive(const ClusterMetricsImpl* prev);
+
+                /**
+                 * Get derived metrics.
+                 *
+                 * @return Derived metrics.
+                 */
+                const ClusterMetricsDerived& GetDerived() const
+                {
+                    return derived;
+                }
+
                 /**
                  * Get maximum number of jobs that ever ran concurrently on this node.
                  *
@@ -342,6 +611,13 @@ namespace ignite
                  */
                 int64_t GetReceivedBytesCount();
 
+                /**
+                 * Get number of bytes received per second since the previous snapshot.
+                 *
+                 * @return Bytes per second.
+                 */
+                double GetReceivedBytesRate();
+
                 /**
                  * Get received messages count.
                  *
@@ -349,6 +625,13 @@ namespace ignite
                  */
                 int32_t GetReceivedMessagesCount();
 
+                /**
+                 * Get number of messages received per second since the previous snapshot.
+                 *
+                 * @return Messages per second.
+                 */
+                double GetReceivedMessagesRate();
+
                 /**
                  * Get sent bytes count.
                  *
@@ -356,6 +639,13 @@ namespace ignite
                  */
                 int64_t GetSentBytesCount();
 
+                /**
+                 * Get number of bytes sent per second since the previous snapshot.
+                 *
+                 * @return Bytes per second.
+                 */
+                double GetSentBytesRate();
+
                 /**
                  * Get sent messages count.
                  *
@@ -363,6 +653,13 @@ namespace ignite
                  */
                 int32_t GetSentMessagesCount();
 
+                /**
+                 * Get number of messages sent per second since the previous snapshot.
+                 *
+                 * @return Messages per second.
+                 */
+                double GetSentMessagesRate();
+
                 /**
                  * Return the start time of the JVM.
                  *
@@ -433,6 +730,13 @@ namespace ignite
                  */
                 int64_t GetTotalStartedThreadCount();
 
+                /**
+                 * Get time between the previous snapshot and this one.
+                 *
+                 * @return Time in milliseconds or zero if there is no previous snapshot.
+                 */
+                int64_t GetUpdateInterval();
+
                 /**
                  * Return the uptime of the JVM in milliseconds.
                  *
@@ -443,6 +747,47 @@ namespace ignite
             private:
                 IGNITE_NO_COPY_ASSIGNMENT(ClusterMetricsImpl);
 
+                /**
+                 * Read metrics in one pass using the fixed payload layout.
+                 *
+                 * @param stream Input stream.
+                 * @return True on success and false if the payload does not match
+                 *     the layout. The stream position is left untouched in the latter case.
+                 */
+                bool ReadFixedLayout(interop::InteropInputStream& stream);
+
+                /**
+                 * Read metrics field by field.
+                 *
+                 * @param reader Binary reader.
+                 */
+                void ReadFieldByField(binary::BinaryReaderImpl& reader);
+
+                /**
+                 * Check whether the field is set in the mask of changed fields.
+                 *
+                 * @param mask Mask.
+                 * @param field Field.
+                 * @return True if the field is changed.
+                 */
+                static bool IsChanged(int64_t mask, ClusterMetricsField::Type field)
+                {
+                    return (mask & (static_cast<int64_t>(1) << field)) != 0;
+                }
+
+                /**
+                 * Get rate of change of the counter.
+                 *
+                 * @param cur Current value.
+                 * @param prev Previous value.
+                 * @param seconds Time between the values in seconds.
+                 * @return Change per second or zero if the counter has gone back.
+                 */
+                static double Rate(int64_t cur, int64_t prev, double seconds)
+                {
+                    return cur >= prev ? (cur - prev) / seconds : 0.0;
+                }
+
                 /** Last update time of this node metrics in raw format. */
                 int64_t lastUpdateTimeRaw;
 
@@ -604,6 +949,9 @@ namespace ignite
 
                 /** Total number of nodes. */
                 int32_t totalNodes;
+
+                /** Derived metrics. */
+                ClusterMetricsDerived derived;
             };
         }
     }
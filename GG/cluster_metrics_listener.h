@@ -0,0 +1,59 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+ /**
+  * @file
+  * Declares ignite::cluster::ClusterMetricsListener class.
+  */
+
+#ifndef _IGNITE_CLUSTER_CLUSTER_METRICS_LISTENER
+#define _IGNITE_CLUSTER_CLUSTER_METRICS_LISTENER
+
+#include <ignite/cluster/cluster_metrics.h>
+
+namespace ignite
+{
+    namespace cluster
+    {
+        /**
+         * Cluster metrics listener.
+         *
+         * Receives metrics snapshots of a subscribed cluster group. Callbacks are invoked from
+         * platform threads or from the polling thread of the subscription and should return
+         * quickly.
+         */
+        class IGNITE_IMPORT_EXPORT ClusterMetricsListener
+        {
+        public:
+            /**
+             * Destructor.
+             */
+            virtual ~ClusterMetricsListener()
+            {
+                // No-op.
+            }
+
+            /**
+             * Called when the metrics snapshot of the cluster group has changed.
+             *
+             * @param metrics New metrics snapshot.
+             */
+            virtual void OnMetricsUpdate(ClusterMetrics& metrics) = 0;
+        };
+    }
+}
+
+#endif //_IGNITE_CLUSTER_CLUSTER_METRICS_LISTENER
\ No newline at end of file
@@ -0,0 +1,85 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstring>
+
+#include <ignite/common/concurrent.h>
+
+#include <ignite/impl/cluster/cluster_metrics_op_support.h>
+
+using namespace ignite::common::concurrent;
+
+namespace
+{
+    /**
+     * Message of the platform error for an operation type without a handler.
+     */
+    const char* UNSUPPORTED_OPERATION_MSG = "Unsupported operation type";
+}
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cluster
+        {
+            ClusterMetricsOpSupport::ClusterMetricsOpSupport(int32_t firstOp) :
+                firstOp(firstOp),
+                rejected(0)
+            {
+                // No-op.
+            }
+
+            bool ClusterMetricsOpSupport::IsSupported(int32_t op)
+            {
+                int32_t rejected0 = Atomics::CompareAndSet32Val(&rejected, 0, 0);
+
+                return (rejected0 & GetBit(op)) == 0;
+            }
+
+            bool ClusterMetricsOpSupport::Check(int32_t op, const IgniteError& err)
+            {
+                if (err.GetCode() == IgniteError::IGNITE_SUCCESS)
+                    return true;
+
+                if (!IsUnsupportedOperation(err))
+                    throw err;
+
+                int32_t rejected0;
+
+                do
+                {
+                    rejected0 = Atomics::CompareAndSet32Val(&rejected, 0, 0);
+                }
+                while (!Atomics::CompareAndSet32(&rejected, rejected0, rejected0 | GetBit(op)));
+
+                return false;
+            }
+
+            bool ClusterMetricsOpSupport::IsUnsupportedOperation(const IgniteError& err)
+            {
+                if (err.GetCode() == IgniteError::IGNITE_ERR_UNSUPPORTED_OPERATION)
+                    return true;
+
+                // The platform reports an operation type it has no handler for with a generic
+                // exception, so the message is the only way to tell it from a real failure.
+                const char* text = err.GetText();
+
+                return text && strstr(text, UNSUPPORTED_OPERATION_MSG) != 0;
+            }
+        }
+    }
+}
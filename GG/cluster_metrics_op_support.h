@@ -0,0 +1,104 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _IGNITE_CLUSTER_CLUSTER_METRICS_OP_SUPPORT
+#define _IGNITE_CLUSTER_CLUSTER_METRICS_OP_SUPPORT
+
+#include <stdint.h>
+
+#include <ignite/common/common.h>
+#include <ignite/ignite_error.h>
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cluster
+        {
+            /**
+             * Support of the optional metrics operations by the platform.
+             *
+             * Optional operations need platform handlers which a platform version may lack.
+             * Every operation is tried until the platform rejects it as unsupported, and the
+             * caller falls back to the baseline operations from then on. Any other error is
+             * passed on and does not affect later calls.
+             *
+             * Operations are numbered from the first optional operation, and at most 32 of
+             * them are tracked.
+             */
+            class IGNITE_FRIEND_EXPORT ClusterMetricsOpSupport
+            {
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param firstOp First optional operation.
+                 */
+                explicit ClusterMetricsOpSupport(int32_t firstOp);
+
+                /**
+                 * Check whether the operation has not been rejected as unsupported.
+                 *
+                 * @param op Operation.
+                 * @return True if the operation is worth trying.
+                 */
+                bool IsSupported(int32_t op);
+
+                /**
+                 * Check result of the operation.
+                 *
+                 * @param op Operation.
+                 * @param err Error of the operation.
+                 * @return True if the operation has succeeded and false if the platform does not
+                 *     support it. In the latter case the operation is not tried again.
+                 *
+                 * @throw IgniteError if the operation has failed for any other reason.
+                 */
+                bool Check(int32_t op, const IgniteError& err);
+
+                /**
+                 * Check whether the error means that the platform has no handler for the operation.
+                 *
+                 * @param err Error.
+                 * @return True if the operation is not supported.
+                 */
+                static bool IsUnsupportedOperation(const IgniteError& err);
+
+            private:
+                IGNITE_NO_COPY_ASSIGNMENT(ClusterMetricsOpSupport);
+
+                /**
+                 * Get bit of the operation.
+                 *
+                 * @param op Operation.
+                 * @return Bit.
+                 */
+                int32_t GetBit(int32_t op) const
+                {
+                    return 1 << (op - firstOp);
+                }
+
+                /** First optional operation. */
+                const int32_t firstOp;
+
+                /** Bit set of the rejected operations. */
+                int32_t rejected;
+            };
+        }
+    }
+}
+
+#endif //_IGNITE_CLUSTER_CLUSTER_METRICS_OP_SUPPORT
@@ -0,0 +1,146 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef _WIN32
+#   include <windows.h>
+#endif
+
+#include <limits>
+
+#include <ignite/impl/cluster/cluster_metrics_snapshot_holder.h>
+
+using namespace ignite::common::concurrent;
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cluster
+        {
+            ClusterMetricsSnapshotHolder::ClusterMetricsSnapshotHolder() :
+                seq(0)
+            {
+                memset(buffers, 0, sizeof(buffers));
+            }
+
+            void ClusterMetricsSnapshotHolder::Publish(const SP_ClusterMetricsImpl& metrics)
+            {
+                ClusterMetricsImpl& src = *metrics.Get();
+
+                CsLockGuard guard(lock);
+
+                // Zero is reserved for the empty holder, so the counter wraps to two to keep parity.
+                int32_t next = seq == std::numeric_limits<int32_t>::max() ? 2 : seq + 1;
+
+                // Readers of the current value use the other buffer. Anyone still reading this
+                // one has seen an older counter value and will retry once the counter moves.
+                ClusterMetricsSnapshot& dst = buffers[next & 1];
+
+                dst.lastUpdateTimeRaw = src.GetLastUpdateTimeRaw();
+                dst.currentCpuLoad = src.GetCurrentCpuLoad();
+                dst.currentGcCpuLoad = src.GetCurrentGcCpuLoad();
+                dst.heapMemoryUsed = src.GetHeapMemoryUsed();
+                dst.heapMemoryMaximum = src.GetHeapMemoryMaximum();
+                dst.currentActiveJobs = src.GetCurrentActiveJobs();
+                dst.currentWaitingJobs = src.GetCurrentWaitingJobs();
+                dst.currentRejectedJobs = src.GetCurrentRejectedJobs();
+                dst.outboundMessagesQueueSize = src.GetOutboundMessagesQueueSize();
+                dst.currentThreadCount = src.GetCurrentThreadCount();
+                dst.totalCpus = src.GetTotalCpus();
+
+                this->metrics = metrics;
+
+                Fence();
+
+                seq = next;
+            }
+
+            SP_ClusterMetricsImpl ClusterMetricsSnapshotHolder::GetMetrics()
+            {
+                CsLockGuard guard(lock);
+
+                return metrics;
+            }
+
+            bool ClusterMetricsSnapshotHolder::IsPublished() const
+            {
+                return seq != 0;
+            }
+
+            bool ClusterMetricsSnapshotHolder::Read(ClusterMetricsSnapshot& dst) const
+            {
+                while (true)
+                {
+                    int32_t before = seq;
+
+                    if (before == 0)
+                        return false;
+
+                    Fence();
+
+                    const ClusterMetricsSnapshot& src = buffers[before & 1];
+
+                    dst.lastUpdateTimeRaw = src.lastUpdateTimeRaw;
+                    dst.currentCpuLoad = src.currentCpuLoad;
+                    dst.currentGcCpuLoad = src.currentGcCpuLoad;
+                    dst.heapMemoryUsed = src.heapMemoryUsed;
+                    dst.heapMemoryMaximum = src.heapMemoryMaximum;
+                    dst.currentActiveJobs = src.currentActiveJobs;
+                    dst.currentWaitingJobs = src.currentWaitingJobs;
+                    dst.currentRejectedJobs = src.currentRejectedJobs;
+                    dst.outboundMessagesQueueSize = src.outboundMessagesQueueSize;
+                    dst.currentThreadCount = src.currentThreadCount;
+                    dst.totalCpus = src.totalCpus;
+
+                    Fence();
+
+                    if (seq == before)
+                        return true;
+                }
+            }
+
+            double ClusterMetricsSnapshotHolder::GetCurrentCpuLoad() const
+            {
+                ClusterMetricsSnapshot snapshot;
+
+                return Read(snapshot) ? snapshot.currentCpuLoad : 0.0;
+            }
+
+            int32_t ClusterMetricsSnapshotHolder::GetCurrentWaitingJobs() const
+            {
+                ClusterMetricsSnapshot snapshot;
+
+                return Read(snapshot) ? snapshot.currentWaitingJobs : 0;
+            }
+
+            int32_t ClusterMetricsSnapshotHolder::GetOutboundMessagesQueueSize() const
+            {
+                ClusterMetricsSnapshot snapshot;
+
+                return Read(snapshot) ? snapshot.outboundMessagesQueueSize : 0;
+            }
+
+            void ClusterMetricsSnapshotHolder::Fence()
+            {
+#ifdef _WIN32
+                MemoryBarrier();
+#else
+                __sync_synchronize();
+#endif
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,128 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _IGNITE_CLUSTER_CLUSTER_METRICS_SNAPSHOT_HOLDER
+#define _IGNITE_CLUSTER_CLUSTER_METRICS_SNAPSHOT_HOLDER
+
+#include <ignite/common/concurrent.h>
+
+#include <ignite/impl/cluster/cluster_metrics_impl.h>
+#include <ignite/impl/cluster/compact_cluster_metrics.h>
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cluster
+        {
+            /**
+             * Holder of the latest cluster metrics snapshot.
+             *
+             * A single refresher thread publishes new snapshots while any number of threads
+             * read them. Values are double-buffered and guarded by a sequence counter: the
+             * publisher fills the inactive buffer and then advances the counter, and readers
+             * retry if the counter has moved while they were copying. Readers never take a
+             * lock or touch reference counters, so they do not contend with each other.
+             */
+            class IGNITE_FRIEND_EXPORT ClusterMetricsSnapshotHolder
+            {
+            public:
+                /**
+                 * Constructor. Holder is empty until the first snapshot is published.
+                 */
+                ClusterMetricsSnapshotHolder();
+
+                /**
+                 * Publish new snapshot.
+                 *
+                 * Intended to be called by a single refresher thread. Concurrent publishers
+                 * are serialized, but never block readers.
+                 *
+                 * @param metrics New snapshot.
+                 */
+                void Publish(const SP_ClusterMetricsImpl& metrics);
+
+                /**
+                 * Get the latest published snapshot.
+                 *
+                 * Unlike other methods this one copies a shared pointer and takes a lock,
+                 * so it is meant for callers that need all metrics rather than hot paths.
+                 *
+                 * @return Latest snapshot or invalid pointer if nothing has been published yet.
+                 */
+                SP_ClusterMetricsImpl GetMetrics();
+
+                /**
+                 * Check whether any snapshot has been published.
+                 *
+                 * @return True if a snapshot is available.
+                 */
+                bool IsPublished() const;
+
+                /**
+                 * Read consistent copy of the latest snapshot values.
+                 *
+                 * @param dst Destination.
+                 * @return True if a snapshot has been published and copied.
+                 */
+                bool Read(ClusterMetricsSnapshot& dst) const;
+
+                /**
+                 * Get current CPU load of the latest snapshot.
+                 *
+                 * @return Current CPU load or zero if nothing has been published yet.
+                 */
+                double GetCurrentCpuLoad() const;
+
+                /**
+                 * Get current waiting jobs of the latest snapshot.
+                 *
+                 * @return Current waiting jobs or zero if nothing has been published yet.
+                 */
+                int32_t GetCurrentWaitingJobs() const;
+
+                /**
+                 * Get outbound messages queue size of the latest snapshot.
+                 *
+                 * @return Outbound messages queue size or zero if nothing has been published yet.
+                 */
+                int32_t GetOutboundMessagesQueueSize() const;
+
+            private:
+                IGNITE_NO_COPY_ASSIGNMENT(ClusterMetricsSnapshotHolder);
+
+                /**
+                 * Full memory barrier.
+                 */
+                static void Fence();
+
+                /** Sequence counter. Odd values select the second buffer, zero means nothing is published. */
+                volatile int32_t seq;
+
+                /** Value buffers. */
+                ClusterMetricsSnapshot buffers[2];
+
+                /** Lock serializing publishers. */
+                common::concurrent::CriticalSection lock;
+
+                /** Latest published snapshot. */
+                SP_ClusterMetricsImpl metrics;
+            };
+        }
+    }
+}
+
+#endif //_IGNITE_CLUSTER_CLUSTER_METRICS_SNAPSHOT_HOLDER
\ No newline at end of file
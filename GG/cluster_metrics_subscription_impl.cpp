@@ -0,0 +1,230 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef _WIN32
+#   include <windows.h>
+#else
+#   include <pthread.h>
+#endif
+
+#include <limits>
+
+#include <ignite/impl/cluster/cluster_metrics_subscription_impl.h>
+#include <ignite/impl/cluster/cluster_group_impl.h>
+
+using namespace ignite::common::concurrent;
+using namespace ignite::cluster;
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cluster
+        {
+            namespace
+            {
+                /**
+                 * Polling thread routine.
+                 *
+                 * @param arg Heap allocated pointer to the subscription. Deleted by the routine.
+                 * @return Zero.
+                 */
+#ifdef _WIN32
+                DWORD WINAPI PollRoutine(LPVOID arg)
+#else
+                void* PollRoutine(void* arg)
+#endif
+                {
+                    SP_ClusterMetricsSubscriptionImpl* sub = static_cast<SP_ClusterMetricsSubscriptionImpl*>(arg);
+
+                    sub->Get()->Poll();
+
+                    delete sub;
+
+                    return 0;
+                }
+            }
+
+            ClusterMetricsSubscriptionImpl::ClusterMetricsSubscriptionImpl(
+                const SharedPointer<ClusterMetricsListener>& lsnr, int64_t minInterval) :
+                lsnr(lsnr), minInterval(minInterval), lastUpdateTime(0), polling(false)
+            {
+                // No-op.
+            }
+
+            ClusterMetricsSubscriptionImpl::~ClusterMetricsSubscriptionImpl()
+            {
+                // No-op.
+            }
+
+            void ClusterMetricsSubscriptionImpl::OnMetricsUpdate(binary::BinaryReaderImpl& reader)
+            {
+                interop::InteropInputStream* stream = reader.GetStream();
+
+                int32_t pos = stream->Position();
+                int64_t updateTime = stream->ReadInt64();
+                stream->Position(pos);
+
+                SP_ClusterMetricsImpl snapshot;
+
+                {
+                    CsLockGuard guard(lock);
+
+                    if (!Accept(updateTime))
+                        return;
+
+                    snapshot = SP_ClusterMetricsImpl(new ClusterMetricsImpl(reader));
+
+                    snapshot.Get()->Derive(last.Get());
+                    last = snapshot;
+                }
+
+                Notify(snapshot);
+            }
+
+            void ClusterMetricsSubscriptionImpl::OnMetricsUpdate(const SP_ClusterMetricsImpl& snapshot)
+            {
+                {
+                    CsLockGuard guard(lock);
+
+                    if (!Accept(snapshot.Get()->GetLastUpdateTimeRaw()))
+                        return;
+
+                    last = snapshot;
+                }
+
+                Notify(snapshot);
+            }
+
+            int64_t ClusterMetricsSubscriptionImpl::GetMinInterval() const
+            {
+                return minInterval;
+            }
+
+            void ClusterMetricsSubscriptionImpl::StartPolling(const SP_ClusterMetricsSubscriptionImpl& self,
+                const SharedPointer<ClusterGroupImpl>& group)
+            {
+                ClusterMetricsSubscriptionImpl* sub = self.Get();
+
+                {
+                    CsLockGuard guard(sub->pollLock);
+
+                    sub->group = group;
+                    sub->polling = true;
+                }
+
+                SP_ClusterMetricsSubscriptionImpl* arg = new SP_ClusterMetricsSubscriptionImpl(self);
+
+#ifdef _WIN32
+                HANDLE thread = CreateThread(NULL, 0, PollRoutine, arg, 0, NULL);
+
+                bool started = thread != NULL;
+
+                if (started)
+                    CloseHandle(thread);
+#else
+                pthread_t thread;
+
+                bool started = pthread_create(&thread, NULL, PollRoutine, arg) == 0;
+
+                if (started)
+                    pthread_detach(thread);
+#endif
+
+                if (!started)
+                {
+                    delete arg;
+
+                    sub->StopPolling();
+
+                    const char* msg = "Can not start the cluster metrics polling thread.";
+                    throw IgniteError(IgniteError::IGNITE_ERR_GENERIC, msg);
+                }
+            }
+
+            void ClusterMetricsSubscriptionImpl::StopPolling()
+            {
+                CsLockGuard guard(pollLock);
+
+                polling = false;
+
+                pollCond.NotifyAll();
+            }
+
+            bool ClusterMetricsSubscriptionImpl::IsPolling()
+            {
+                CsLockGuard guard(pollLock);
+
+                return polling;
+            }
+
+            void ClusterMetricsSubscriptionImpl::Poll()
+            {
+                int32_t interval = MIN_POLL_INTERVAL;
+
+                if (minInterval > interval)
+                {
+                    int32_t maxInterval = std::numeric_limits<int32_t>::max();
+
+                    interval = minInterval < maxInterval ? static_cast<int32_t>(minInterval) : maxInterval;
+                }
+
+                while (true)
+                {
+                    try
+                    {
+                        OnMetricsUpdate(group.Get()->GetMetrics());
+                    }
+                    catch (const IgniteError&)
+                    {
+                        // The group may have no nodes for a while. Try again on the next poll.
+                    }
+
+                    CsLockGuard guard(pollLock);
+
+                    if (polling)
+                        pollCond.WaitFor(pollLock, interval);
+
+                    if (!polling)
+                    {
+                        group = SharedPointer<ClusterGroupImpl>();
+
+                        break;
+                    }
+                }
+            }
+
+            bool ClusterMetricsSubscriptionImpl::Accept(int64_t updateTime)
+            {
+                if (lastUpdateTime != 0 && (updateTime <= lastUpdateTime || updateTime - lastUpdateTime < minInterval))
+                    return false;
+
+                lastUpdateTime = updateTime;
+
+                return true;
+            }
+
+            void ClusterMetricsSubscriptionImpl::Notify(const SP_ClusterMetricsImpl& snapshot)
+            {
+                // Listener is called without the lock held, so a slow or re-entrant listener
+                // does not block other updates.
+                ClusterMetrics metrics(snapshot);
+
+                lsnr.Get()->OnMetricsUpdate(metrics);
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,179 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _IGNITE_CLUSTER_CLUSTER_METRICS_SUBSCRIPTION_IMPL
+#define _IGNITE_CLUSTER_CLUSTER_METRICS_SUBSCRIPTION_IMPL
+
+#include <ignite/common/concurrent.h>
+
+#include <ignite/cluster/cluster_metrics_listener.h>
+#include <ignite/impl/handle_registry.h>
+#include <ignite/impl/cluster/cluster_metrics_impl.h>
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cluster
+        {
+            /* Forward declaration. */
+            class ClusterGroupImpl;
+
+            /**
+             * Cluster metrics subscription implementation.
+             *
+             * Registered in the handle registry so the platform can address it when pushing
+             * new snapshots. Platforms which do not push snapshots are polled by a thread of
+             * the subscription instead. The listener is notified only when the snapshot has
+             * changed and not more often than the requested minimal interval.
+             */
+            class IGNITE_FRIEND_EXPORT ClusterMetricsSubscriptionImpl : public HandleRegistryEntry
+            {
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param lsnr Listener.
+                 * @param minInterval Minimal interval between notifications in milliseconds.
+                 */
+                ClusterMetricsSubscriptionImpl(
+                    const common::concurrent::SharedPointer<ignite::cluster::ClusterMetricsListener>& lsnr,
+                    int64_t minInterval);
+
+                /**
+                 * Destructor.
+                 */
+                virtual ~ClusterMetricsSubscriptionImpl();
+
+                /**
+                 * Process metrics update pushed by the platform.
+                 *
+                 * @param reader Reader positioned at the start of the metrics payload.
+                 */
+                void OnMetricsUpdate(binary::BinaryReaderImpl& reader);
+
+                /**
+                 * Process metrics snapshot fetched by polling.
+                 *
+                 * The snapshot is passed to the listener as is, so its rates are the ones
+                 * computed by the cluster group against the snapshot it fetched before.
+                 *
+                 * @param snapshot Metrics snapshot.
+                 */
+                void OnMetricsUpdate(const SP_ClusterMetricsImpl& snapshot);
+
+                /**
+                 * Get minimal interval between notifications.
+                 *
+                 * @return Minimal interval in milliseconds.
+                 */
+                int64_t GetMinInterval() const;
+
+                /**
+                 * Start polling the cluster group metrics.
+                 *
+                 * Used when the platform does not push metrics updates. The thread fetches
+                 * the metrics once per the minimal interval, but not more often than once
+                 * per MIN_POLL_INTERVAL, until StopPolling() is called. The thread keeps the
+                 * subscription and the cluster group alive while it runs.
+                 *
+                 * @param self Pointer to this subscription.
+                 * @param group Cluster group to poll.
+                 *
+                 * @throw IgniteError if the thread can not be started.
+                 */
+                static void StartPolling(const common::concurrent::SharedPointer<ClusterMetricsSubscriptionImpl>& self,
+                    const common::concurrent::SharedPointer<ClusterGroupImpl>& group);
+
+                /**
+                 * Stop polling the cluster group metrics.
+                 *
+                 * Returns without waiting for the thread, so a notification already in
+                 * progress may still complete after the return.
+                 */
+                void StopPolling();
+
+                /**
+                 * Check whether the cluster group metrics are polled by this subscription.
+                 *
+                 * @return True if the metrics are polled.
+                 */
+                bool IsPolling();
+
+                /**
+                 * Poll the cluster group metrics until polling is stopped.
+                 *
+                 * Runs on the thread started by StartPolling().
+                 */
+                void Poll();
+
+                /** Minimal interval between two polls in milliseconds. */
+                static const int32_t MIN_POLL_INTERVAL = 100;
+
+            private:
+                IGNITE_NO_COPY_ASSIGNMENT(ClusterMetricsSubscriptionImpl);
+
+                /**
+                 * Check whether the listener should be notified about the snapshot and
+                 * remember its update time if so. Should be called with the lock held.
+                 *
+                 * @param updateTime Last update time of the snapshot.
+                 * @return True if the listener should be notified.
+                 */
+                bool Accept(int64_t updateTime);
+
+                /**
+                 * Notify the listener. Should be called without the lock held.
+                 *
+                 * @param snapshot Metrics snapshot.
+                 */
+                void Notify(const SP_ClusterMetricsImpl& snapshot);
+
+                /** Listener. */
+                common::concurrent::SharedPointer<ignite::cluster::ClusterMetricsListener> lsnr;
+
+                /** Minimal interval between notifications. */
+                int64_t minInterval;
+
+                /** Last update time of the snapshot the listener was notified about. */
+                int64_t lastUpdateTime;
+
+                /** Snapshot the listener was notified about, used to compute rates of the next one. */
+                SP_ClusterMetricsImpl last;
+
+                /** Lock serializing notifications. */
+                common::concurrent::CriticalSection lock;
+
+                /** Cluster group polled by the thread. Null if the platform pushes the updates. */
+                common::concurrent::SharedPointer<ClusterGroupImpl> group;
+
+                /** Polling flag. */
+                bool polling;
+
+                /** Lock guarding the polling flag. */
+                common::concurrent::CriticalSection pollLock;
+
+                /** Condition used to wake up the polling thread when polling is stopped. */
+                common::concurrent::ConditionVariable pollCond;
+            };
+
+            /* Shared pointer. */
+            typedef common::concurrent::SharedPointer<ClusterMetricsSubscriptionImpl> SP_ClusterMetricsSubscriptionImpl;
+        }
+    }
+}
+
+#endif //_IGNITE_CLUSTER_CLUSTER_METRICS_SUBSCRIPTION_IMPL
\ No newline at end of file
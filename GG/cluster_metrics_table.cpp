@@ -0,0 +1,276 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+
+#include <ignite/impl/cluster/cluster_metrics_table.h>
+
+using namespace ignite::impl::cluster;
+
+namespace
+{
+    /**
+     * Orders rows by the values of a column.
+     */
+    struct RowLess
+    {
+        /**
+         * Constructor.
+         *
+         * @param vals Column.
+         * @param largest Put the largest values first.
+         */
+        RowLess(const double* vals, bool largest) :
+            vals(vals),
+            largest(largest)
+        {
+            // No-op.
+        }
+
+        /**
+         * Compare rows. Ties are broken by the row index, so the order is stable.
+         *
+         * @param lhs First row.
+         * @param rhs Second row.
+         * @return True if the first row goes before the second one.
+         */
+        bool operator()(int32_t lhs, int32_t rhs) const
+        {
+            double l = vals[lhs];
+            double r = vals[rhs];
+
+            if (l == r)
+                return lhs < rhs;
+
+            return largest ? l > r : l < r;
+        }
+
+        /** Column. */
+        const double* vals;
+
+        /** Put the largest values first. */
+        bool largest;
+    };
+
+    /**
+     * Clear mask entries of the values which do not match the condition.
+     *
+     * Every operator has its own branchless loop. Mask entries are selected rather than
+     * and-ed with the comparison result, as the latter only vectorizes with SSE4.1 and up.
+     *
+     * @param vals Column.
+     * @param cnt Number of values.
+     * @param cond Condition.
+     * @param mask Mask.
+     */
+    void Match(const double* vals, int32_t cnt, const ClusterMetricsCondition& cond, int32_t* mask)
+    {
+        double operand = cond.value;
+
+        switch (cond.op)
+        {
+            case ClusterMetricsCondition::Op::LESS:
+            {
+                for (int32_t i = 0; i < cnt; ++i)
+                    mask[i] = vals[i] < operand ? mask[i] : 0;
+
+                break;
+            }
+
+            case ClusterMetricsCondition::Op::LESS_OR_EQUAL:
+            {
+                for (int32_t i = 0; i < cnt; ++i)
+                    mask[i] = vals[i] <= operand ? mask[i] : 0;
+
+                break;
+            }
+
+            case ClusterMetricsCondition::Op::GREATER:
+            {
+                for (int32_t i = 0; i < cnt; ++i)
+                    mask[i] = vals[i] > operand ? mask[i] : 0;
+
+                break;
+            }
+
+            case ClusterMetricsCondition::Op::GREATER_OR_EQUAL:
+            {
+                for (int32_t i = 0; i < cnt; ++i)
+                    mask[i] = vals[i] >= operand ? mask[i] : 0;
+
+                break;
+            }
+
+            default:
+                break;
+        }
+    }
+}
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cluster
+        {
+            ClusterMetricsTable::ClusterMetricsTable() :
+                size(0)
+            {
+                // No-op.
+            }
+
+            void ClusterMetricsTable::Reserve(int32_t cnt)
+            {
+                for (int32_t i = 0; i < ClusterMetricsField::COUNT; ++i)
+                    columns[i].reserve(cnt);
+            }
+
+            void ClusterMetricsTable::Clear()
+            {
+                for (int32_t i = 0; i < ClusterMetricsField::COUNT; ++i)
+                    columns[i].clear();
+
+                size = 0;
+            }
+
+            int32_t ClusterMetricsTable::Add(ClusterMetricsImpl& metrics)
+            {
+                for (int32_t i = 0; i < ClusterMetricsField::COUNT; ++i)
+                    columns[i].push_back(0.0);
+
+                Set(size, metrics);
+
+                return size++;
+            }
+
+            void ClusterMetricsTable::Set(int32_t row, ClusterMetricsImpl& metrics)
+            {
+                CompactClusterMetrics compact;
+
+                metrics.CopyTo(compact);
+
+                for (int32_t i = 0; i < ClusterMetricsField::COUNT; ++i)
+                {
+                    ClusterMetricsField::Type field = static_cast<ClusterMetricsField::Type>(i);
+
+                    columns[i][row] = compact.GetValue(field);
+                }
+            }
+
+            void ClusterMetricsTable::Remove(int32_t row)
+            {
+                int32_t last = size - 1;
+
+                for (int32_t i = 0; i < ClusterMetricsField::COUNT; ++i)
+                {
+                    columns[i][row] = columns[i][last];
+                    columns[i].pop_back();
+                }
+
+                size = last;
+            }
+
+            int32_t ClusterMetricsTable::ArgMin(ClusterMetricsField::Type field) const
+            {
+                if (!size)
+                    return -1;
+
+                const double* vals = &columns[field][0];
+
+                int32_t res = 0;
+
+                for (int32_t i = 1; i < size; ++i)
+                    res = vals[i] < vals[res] ? i : res;
+
+                return res;
+            }
+
+            int32_t ClusterMetricsTable::ArgMax(ClusterMetricsField::Type field) const
+            {
+                if (!size)
+                    return -1;
+
+                const double* vals = &columns[field][0];
+
+                int32_t res = 0;
+
+                for (int32_t i = 1; i < size; ++i)
+                    res = vals[i] > vals[res] ? i : res;
+
+                return res;
+            }
+
+            void ClusterMetricsTable::Top(ClusterMetricsField::Type field, int32_t cnt, bool largest,
+                std::vector<int32_t>& rows) const
+            {
+                if (cnt <= 0 || !size)
+                {
+                    rows.clear();
+
+                    return;
+                }
+
+                rows.resize(size);
+
+                for (int32_t i = 0; i < size; ++i)
+                    rows[i] = i;
+
+                RowLess less(&columns[field][0], largest);
+
+                if (cnt < size)
+                {
+                    std::nth_element(rows.begin(), rows.begin() + cnt, rows.end(), less);
+
+                    rows.resize(cnt);
+                }
+
+                std::sort(rows.begin(), rows.end(), less);
+            }
+
+            void ClusterMetricsTable::Filter(const std::vector<ClusterMetricsCondition>& conds,
+                std::vector<int32_t>& rows) const
+            {
+                if (!size)
+                {
+                    rows.clear();
+
+                    return;
+                }
+
+                // Output vector serves as the match mask first and is compacted in place.
+                rows.assign(size, 1);
+
+                int32_t* mask = &rows[0];
+
+                for (size_t i = 0; i < conds.size(); ++i)
+                    Match(&columns[conds[i].field][0], size, conds[i], mask);
+
+                int32_t matched = 0;
+
+                for (int32_t i = 0; i < size; ++i)
+                {
+                    int32_t match = mask[i];
+
+                    // Entries before i are already read, so the row index may overwrite them.
+                    mask[matched] = i;
+                    matched += match;
+                }
+
+                rows.resize(matched);
+            }
+        }
+    }
+}
\ No newline at end of file
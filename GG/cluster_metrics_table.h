@@ -0,0 +1,212 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _IGNITE_CLUSTER_CLUSTER_METRICS_TABLE
+#define _IGNITE_CLUSTER_CLUSTER_METRICS_TABLE
+
+#include <vector>
+
+#include <ignite/impl/cluster/cluster_metrics_impl.h>
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cluster
+        {
+            /**
+             * Condition on the value of a metric.
+             */
+            struct ClusterMetricsCondition
+            {
+                /**
+                 * Comparison operator.
+                 */
+                struct Op
+                {
+                    enum Type
+                    {
+                        /** Value is less than the operand. */
+                        LESS = 0,
+
+                        /** Value is less than or equal to the operand. */
+                        LESS_OR_EQUAL = 1,
+
+                        /** Value is greater than the operand. */
+                        GREATER = 2,
+
+                        /** Value is greater than or equal to the operand. */
+                        GREATER_OR_EQUAL = 3
+                    };
+                };
+
+                /**
+                 * Constructor.
+                 *
+                 * @param field Metric.
+                 * @param op Comparison operator.
+                 * @param value Operand. Timestamps are given in milliseconds.
+                 */
+                ClusterMetricsCondition(ClusterMetricsField::Type field, Op::Type op, double value) :
+                    field(field),
+                    op(op),
+                    value(value)
+                {
+                    // No-op.
+                }
+
+                /** Metric. */
+                ClusterMetricsField::Type field;
+
+                /** Comparison operator. */
+                Op::Type op;
+
+                /** Operand. */
+                double value;
+            };
+
+            /**
+             * Table of the metrics snapshots of many nodes.
+             *
+             * Every metric is stored as a contiguous column of values, one per row, so
+             * ranking and filtering the whole topology by a metric is a linear scan over
+             * one array instead of a walk over the snapshot objects. Rows are addressed by
+             * index; removal moves the last row into the freed one.
+             */
+            class IGNITE_FRIEND_EXPORT ClusterMetricsTable
+            {
+            public:
+                /**
+                 * Constructor.
+                 */
+                ClusterMetricsTable();
+
+                /**
+                 * Reserve memory for the given number of rows.
+                 *
+                 * @param cnt Number of rows.
+                 */
+                void Reserve(int32_t cnt);
+
+                /**
+                 * Remove all rows.
+                 */
+                void Clear();
+
+                /**
+                 * Add row.
+                 *
+                 * @param metrics Node snapshot.
+                 * @return Index of the row.
+                 */
+                int32_t Add(ClusterMetricsImpl& metrics);
+
+                /**
+                 * Replace values of the row.
+                 *
+                 * @param row Index of the row.
+                 * @param metrics Node snapshot.
+                 */
+                void Set(int32_t row, ClusterMetricsImpl& metrics);
+
+                /**
+                 * Remove row. The last row takes its index.
+                 *
+                 * @param row Index of the row.
+                 */
+                void Remove(int32_t row);
+
+                /**
+                 * Get number of rows.
+                 *
+                 * @return Number of rows.
+                 */
+                int32_t GetSize() const
+                {
+                    return size;
+                }
+
+                /**
+                 * Get column of the metric values.
+                 *
+                 * @param field Metric.
+                 * @return Values by row. Timestamps are given in milliseconds.
+                 */
+                const double* GetColumn(ClusterMetricsField::Type field) const
+                {
+                    return size ? &columns[field][0] : 0;
+                }
+
+                /**
+                 * Get value of the metric.
+                 *
+                 * @param row Index of the row.
+                 * @param field Metric.
+                 * @return Value. Timestamps are given in milliseconds.
+                 */
+                double GetValue(int32_t row, ClusterMetricsField::Type field) const
+                {
+                    return columns[field][row];
+                }
+
+                /**
+                 * Find the row with the smallest value of the metric.
+                 *
+                 * @param field Metric.
+                 * @return Index of the first such row or -1 if the table is empty.
+                 */
+                int32_t ArgMin(ClusterMetricsField::Type field) const;
+
+                /**
+                 * Find the row with the largest value of the metric.
+                 *
+                 * @param field Metric.
+                 * @return Index of the first such row or -1 if the table is empty.
+                 */
+                int32_t ArgMax(ClusterMetricsField::Type field) const;
+
+                /**
+                 * Find the rows with the smallest or the largest values of the metric.
+                 *
+                 * @param field Metric.
+                 * @param cnt Number of rows to find.
+                 * @param largest Find the largest values if @c true and the smallest otherwise.
+                 * @param rows Found rows, best first.
+                 */
+                void Top(ClusterMetricsField::Type field, int32_t cnt, bool largest, std::vector<int32_t>& rows) const;
+
+                /**
+                 * Find the rows matching all the conditions.
+                 *
+                 * @param conds Conditions.
+                 * @param rows Matching rows in the ascending order.
+                 */
+                void Filter(const std::vector<ClusterMetricsCondition>& conds, std::vector<int32_t>& rows) const;
+
+            private:
+                IGNITE_NO_COPY_ASSIGNMENT(ClusterMetricsTable);
+
+                /** Number of rows. */
+                int32_t size;
+
+                /** Values by metric. */
+                std::vector<double> columns[ClusterMetricsField::COUNT];
+            };
+        }
+    }
+}
+
+#endif //_IGNITE_CLUSTER_CLUSTER_METRICS_TABLE
\ No newline at end of file
@@ -0,0 +1,312 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ignite/cluster/cluster_metrics_view.h"
+
+using namespace ignite::common::concurrent;
+using namespace ignite::impl::cluster;
+
+namespace ignite
+{
+    namespace cluster
+    {
+        ClusterMetricsView::ClusterMetricsView(SharedPointer<ignite::impl::cluster::ClusterMetricsViewImpl> impl) :
+            impl(impl)
+        {
+            // No-op.
+        }
+
+        float ClusterMetricsView::GetAverageActiveJobs()
+        {
+            return impl.Get()->GetAverageActiveJobs();
+        }
+
+        float ClusterMetricsView::GetAverageCancelledJobs()
+        {
+            return impl.Get()->GetAverageCancelledJobs();
+        }
+
+        double ClusterMetricsView::GetAverageCpuLoad()
+        {
+            return impl.Get()->GetAverageCpuLoad();
+        }
+
+        double ClusterMetricsView::GetAverageJobExecuteTime()
+        {
+            return impl.Get()->GetAverageJobExecuteTime();
+        }
+
+        double ClusterMetricsView::GetAverageJobWaitTime()
+        {
+            return impl.Get()->GetAverageJobWaitTime();
+        }
+
+        float ClusterMetricsView::GetAverageRejectedJobs()
+        {
+            return impl.Get()->GetAverageRejectedJobs();
+        }
+
+        float ClusterMetricsView::GetAverageWaitingJobs()
+        {
+            return impl.Get()->GetAverageWaitingJobs();
+        }
+
+        float ClusterMetricsView::GetBusyTimePercentage()
+        {
+            return impl.Get()->GetBusyTimePercentage();
+        }
+
+        int32_t ClusterMetricsView::GetCurrentActiveJobs()
+        {
+            return impl.Get()->GetCurrentActiveJobs();
+        }
+
+        int32_t ClusterMetricsView::GetCurrentCancelledJobs()
+        {
+            return impl.Get()->GetCurrentCancelledJobs();
+        }
+
+        double ClusterMetricsView::GetCurrentCpuLoad()
+        {
+            return impl.Get()->GetCurrentCpuLoad();
+        }
+
+        int32_t ClusterMetricsView::GetCurrentDaemonThreadCount()
+        {
+            return impl.Get()->GetCurrentDaemonThreadCount();
+        }
+
+        double ClusterMetricsView::GetCurrentGcCpuLoad()
+        {
+            return impl.Get()->GetCurrentGcCpuLoad();
+        }
+
+        int64_t ClusterMetricsView::GetCurrentIdleTime()
+        {
+            return impl.Get()->GetCurrentIdleTime();
+        }
+
+        int64_t ClusterMetricsView::GetCurrentJobExecuteTime()
+        {
+            return impl.Get()->GetCurrentJobExecuteTime();
+        }
+
+        int64_t ClusterMetricsView::GetCurrentJobWaitTime()
+        {
+            return impl.Get()->GetCurrentJobWaitTime();
+        }
+
+        int32_t ClusterMetricsView::GetCurrentRejectedJobs()
+        {
+            return impl.Get()->GetCurrentRejectedJobs();
+        }
+
+        int32_t ClusterMetricsView::GetCurrentThreadCount()
+        {
+            return impl.Get()->GetCurrentThreadCount();
+        }
+
+        int32_t ClusterMetricsView::GetCurrentWaitingJobs()
+        {
+            return impl.Get()->GetCurrentWaitingJobs();
+        }
+
+        int64_t ClusterMetricsView::GetHeapMemoryCommitted()
+        {
+            return impl.Get()->GetHeapMemoryCommitted();
+        }
+
+        int64_t ClusterMetricsView::GetHeapMemoryInitialized()
+        {
+            return impl.Get()->GetHeapMemoryInitialized();
+        }
+
+        int64_t ClusterMetricsView::GetHeapMemoryMaximum()
+        {
+            return impl.Get()->GetHeapMemoryMaximum();
+        }
+
+        int64_t ClusterMetricsView::GetHeapMemoryTotal()
+        {
+            return impl.Get()->GetHeapMemoryTotal();
+        }
+
+        int64_t ClusterMetricsView::GetHeapMemoryUsed()
+        {
+            return impl.Get()->GetHeapMemoryUsed();
+        }
+
+        float ClusterMetricsView::GetIdleTimePercentage()
+        {
+            return impl.Get()->GetIdleTimePercentage();
+        }
+
+        int64_t ClusterMetricsView::GetLastDataVersion()
+        {
+            return impl.Get()->GetLastDataVersion();
+        }
+
+        Timestamp ClusterMetricsView::GetLastUpdateTime()
+        {
+            return impl.Get()->GetLastUpdateTime();
+        }
+
+        int32_t ClusterMetricsView::GetMaximumActiveJobs()
+        {
+            return impl.Get()->GetMaximumActiveJobs();
+        }
+
+        int32_t ClusterMetricsView::GetMaximumCancelledJobs()
+        {
+            return impl.Get()->GetMaximumCancelledJobs();
+        }
+
+        int64_t ClusterMetricsView::GetMaximumJobExecuteTime()
+        {
+            return impl.Get()->GetMaximumJobExecuteTime();
+        }
+
+        int64_t ClusterMetricsView::GetMaximumJobWaitTime()
+        {
+            return impl.Get()->GetMaximumJobWaitTime();
+        }
+
+        int32_t ClusterMetricsView::GetMaximumRejectedJobs()
+        {
+            return impl.Get()->GetMaximumRejectedJobs();
+        }
+
+        int32_t ClusterMetricsView::GetMaximumThreadCount()
+        {
+            return impl.Get()->GetMaximumThreadCount();
+        }
+
+        int32_t ClusterMetricsView::GetMaximumWaitingJobs()
+        {
+            return impl.Get()->GetMaximumWaitingJobs();
+        }
+
+        Timestamp ClusterMetricsView::GetNodeStartTime()
+        {
+            return impl.Get()->GetNodeStartTime();
+        }
+
+        int64_t ClusterMetricsView::GetNonHeapMemoryCommitted()
+        {
+            return impl.Get()->GetNonHeapMemoryCommitted();
+        }
+
+        int64_t ClusterMetricsView::GetNonHeapMemoryInitialized()
+        {
+            return impl.Get()->GetNonHeapMemoryInitialized();
+        }
+
+        int64_t ClusterMetricsView::GetNonHeapMemoryMaximum()
+        {
+            return impl.Get()->GetNonHeapMemoryMaximum();
+        }
+
+        int64_t ClusterMetricsView::GetNonHeapMemoryTotal()
+        {
+            return impl.Get()->GetNonHeapMemoryTotal();
+        }
+
+        int64_t ClusterMetricsView::GetNonHeapMemoryUsed()
+        {
+            return impl.Get()->GetNonHeapMemoryUsed();
+        }
+
+        int32_t ClusterMetricsView::GetOutboundMessagesQueueSize()
+        {
+            return impl.Get()->GetOutboundMessagesQueueSize();
+        }
+
+        int64_t ClusterMetricsView::GetReceivedBytesCount()
+        {
+            return impl.Get()->GetReceivedBytesCount();
+        }
+
+        int32_t ClusterMetricsView::GetReceivedMessagesCount()
+        {
+            return impl.Get()->GetReceivedMessagesCount();
+        }
+
+        int64_t ClusterMetricsView::GetSentBytesCount()
+        {
+            return impl.Get()->GetSentBytesCount();
+        }
+
+        int32_t ClusterMetricsView::GetSentMessagesCount()
+        {
+            return impl.Get()->GetSentMessagesCount();
+        }
+
+        Timestamp ClusterMetricsView::GetStartTime()
+        {
+            return impl.Get()->GetStartTime();
+        }
+
+        int64_t ClusterMetricsView::GetTotalBusyTime()
+        {
+            return impl.Get()->GetTotalBusyTime();
+        }
+
+        int32_t ClusterMetricsView::GetTotalCancelledJobs()
+        {
+            return impl.Get()->GetTotalCancelledJobs();
+        }
+
+        int32_t ClusterMetricsView::GetTotalCpus()
+        {
+            return impl.Get()->GetTotalCpus();
+        }
+
+        int32_t ClusterMetricsView::GetTotalExecutedJobs()
+        {
+            return impl.Get()->GetTotalExecutedJobs();
+        }
+
+        int32_t ClusterMetricsView::GetTotalExecutedTasks()
+        {
+            return impl.Get()->GetTotalExecutedTasks();
+        }
+
+        int64_t ClusterMetricsView::GetTotalIdleTime()
+        {
+            return impl.Get()->GetTotalIdleTime();
+        }
+
+        int32_t ClusterMetricsView::GetTotalNodes()
+        {
+            return impl.Get()->GetTotalNodes();
+        }
+
+        int64_t ClusterMetricsView::GetTotalRejectedJobs()
+        {
+            return impl.Get()->GetTotalRejectedJobs();
+        }
+
+        int64_t ClusterMetricsView::GetTotalStartedThreadCount()
+        {
+            return impl.Get()->GetTotalStartedThreadCount();
+        }
+
+        int64_t ClusterMetricsView::GetUpTime()
+        {
+            return impl.Get()->GetUpTime();
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,383 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <ignite/impl/cluster/cluster_metrics_view_impl.h>
+
+using namespace ignite::common::concurrent;
+using namespace ignite::impl::interop;
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cluster
+        {
+            ClusterMetricsViewImpl::ClusterMetricsViewImpl(SharedPointer<InteropMemory> mem, int32_t pos) :
+                mem(mem), data(0)
+            {
+                if (!IsFixedLayout(*mem.Get(), pos))
+                {
+                    this->mem = CopyToFixedLayout(*mem.Get(), pos);
+
+                    pos = 0;
+                }
+
+                data = this->mem.Get()->Data() + pos;
+            }
+
+            bool ClusterMetricsViewImpl::IsFixedLayout(const InteropMemory& mem, int32_t pos)
+            {
+                if (mem.Length() - pos < ClusterMetricsLayout::LENGTH)
+                    return false;
+
+                const int8_t* data = mem.Data() + pos;
+
+                return data[ClusterMetricsLayout::LAST_UPDATE_TIME] == binary::IGNITE_TYPE_TIMESTAMP &&
+                    data[ClusterMetricsLayout::START_TIME] == binary::IGNITE_TYPE_TIMESTAMP &&
+                    data[ClusterMetricsLayout::NODE_START_TIME] == binary::IGNITE_TYPE_TIMESTAMP;
+            }
+
+            SharedPointer<InteropMemory> ClusterMetricsViewImpl::CopyToFixedLayout(InteropMemory& src, int32_t pos)
+            {
+                static const int32_t timestamps[] = {
+                    ClusterMetricsLayout::LAST_UPDATE_TIME,
+                    ClusterMetricsLayout::START_TIME,
+                    ClusterMetricsLayout::NODE_START_TIME
+                };
+
+                SharedPointer<InteropMemory> dst(new InteropUnpooledMemory(ClusterMetricsLayout::LENGTH));
+
+                int8_t* data = dst.Get()->Data();
+
+                InteropInputStream stream(&src);
+
+                stream.Position(pos);
+
+                int32_t off = 0;
+
+                for (size_t i = 0; i < sizeof(timestamps) / sizeof(timestamps[0]); ++i)
+                {
+                    int32_t ts = timestamps[i];
+
+                    stream.ReadInt8Array(data + off, ts - off);
+
+                    int8_t hdr = stream.ReadInt8();
+
+                    if (hdr == binary::IGNITE_TYPE_TIMESTAMP)
+                        stream.ReadInt8Array(data + ts + 1, 8 + 4);
+                    else if (hdr == binary::IGNITE_HDR_NULL)
+                        memset(data + ts + 1, 0, 8 + 4);
+                    else
+                    {
+                        const char* msg = "Unexpected header of a timestamp in the cluster metrics payload.";
+                        throw IgniteError(IgniteError::IGNITE_ERR_BINARY, msg);
+                    }
+
+                    data[ts] = binary::IGNITE_TYPE_TIMESTAMP;
+
+                    off = ts + 1 + 8 + 4;
+                }
+
+                stream.ReadInt8Array(data + off, ClusterMetricsLayout::LENGTH - off);
+
+                dst.Get()->Length(ClusterMetricsLayout::LENGTH);
+
+                return dst;
+            }
+
+            float ClusterMetricsViewImpl::GetAverageActiveJobs()
+            {
+                return Read<float>(ClusterMetricsLayout::AVERAGE_ACTIVE_JOBS);
+            }
+
+            float ClusterMetricsViewImpl::GetAverageCancelledJobs()
+            {
+                return Read<float>(ClusterMetricsLayout::AVERAGE_CANCELLED_JOBS);
+            }
+
+            double ClusterMetricsViewImpl::GetAverageCpuLoad()
+            {
+                return Read<double>(ClusterMetricsLayout::AVERAGE_CPU_LOAD);
+            }
+
+            double ClusterMetricsViewImpl::GetAverageJobExecuteTime()
+            {
+                return Read<double>(ClusterMetricsLayout::AVERAGE_JOB_EXECUTE_TIME);
+            }
+
+            double ClusterMetricsViewImpl::GetAverageJobWaitTime()
+            {
+                return Read<double>(ClusterMetricsLayout::AVERAGE_JOB_WAIT_TIME);
+            }
+
+            float ClusterMetricsViewImpl::GetAverageRejectedJobs()
+            {
+                return Read<float>(ClusterMetricsLayout::AVERAGE_REJECTED_JOBS);
+            }
+
+            float ClusterMetricsViewImpl::GetAverageWaitingJobs()
+            {
+                return Read<float>(ClusterMetricsLayout::AVERAGE_WAITING_JOBS);
+            }
+
+            float ClusterMetricsViewImpl::GetBusyTimePercentage()
+            {
+                return 1.0f - GetIdleTimePercentage();
+            }
+
+            int32_t ClusterMetricsViewImpl::GetCurrentActiveJobs()
+            {
+                return Read<int32_t>(ClusterMetricsLayout::CURRENT_ACTIVE_JOBS);
+            }
+
+            int32_t ClusterMetricsViewImpl::GetCurrentCancelledJobs()
+            {
+                return Read<int32_t>(ClusterMetricsLayout::CURRENT_CANCELLED_JOBS);
+            }
+
+            double ClusterMetricsViewImpl::GetCurrentCpuLoad()
+            {
+                return Read<double>(ClusterMetricsLayout::CURRENT_CPU_LOAD);
+            }
+
+            int32_t ClusterMetricsViewImpl::GetCurrentDaemonThreadCount()
+            {
+                return Read<int32_t>(ClusterMetricsLayout::CURRENT_DAEMON_THREAD_COUNT);
+            }
+
+            double ClusterMetricsViewImpl::GetCurrentGcCpuLoad()
+            {
+                return Read<double>(ClusterMetricsLayout::CURRENT_GC_CPU_LOAD);
+            }
+
+            int64_t ClusterMetricsViewImpl::GetCurrentIdleTime()
+            {
+                return Read<int64_t>(ClusterMetricsLayout::CURRENT_IDLE_TIME);
+            }
+
+            int64_t ClusterMetricsViewImpl::GetCurrentJobExecuteTime()
+            {
+                return Read<int64_t>(ClusterMetricsLayout::CURRENT_JOB_EXECUTE_TIME);
+            }
+
+            int64_t ClusterMetricsViewImpl::GetCurrentJobWaitTime()
+            {
+                return Read<int64_t>(ClusterMetricsLayout::CURRENT_JOB_WAIT_TIME);
+            }
+
+            int32_t ClusterMetricsViewImpl::GetCurrentRejectedJobs()
+            {
+                return Read<int32_t>(ClusterMetricsLayout::CURRENT_REJECTED_JOBS);
+            }
+
+            int32_t ClusterMetricsViewImpl::GetCurrentThreadCount()
+            {
+                return Read<int32_t>(ClusterMetricsLayout::CURRENT_THREAD_COUNT);
+            }
+
+            int32_t ClusterMetricsViewImpl::GetCurrentWaitingJobs()
+            {
+                return Read<int32_t>(ClusterMetricsLayout::CURRENT_WAITING_JOBS);
+            }
+
+            int64_t ClusterMetricsViewImpl::GetHeapMemoryCommitted()
+            {
+                return Read<int64_t>(ClusterMetricsLayout::HEAP_MEMORY_COMMITTED);
+            }
+
+            int64_t ClusterMetricsViewImpl::GetHeapMemoryInitialized()
+            {
+                return Read<int64_t>(ClusterMetricsLayout::HEAP_MEMORY_INITIALIZED);
+            }
+
+            int64_t ClusterMetricsViewImpl::GetHeapMemoryMaximum()
+            {
+                return Read<int64_t>(ClusterMetricsLayout::HEAP_MEMORY_MAXIMUM);
+            }
+
+            int64_t ClusterMetricsViewImpl::GetHeapMemoryTotal()
+            {
+                return Read<int64_t>(ClusterMetricsLayout::HEAP_MEMORY_TOTAL);
+            }
+
+            int64_t ClusterMetricsViewImpl::GetHeapMemoryUsed()
+            {
+                return Read<int64_t>(ClusterMetricsLayout::HEAP_MEMORY_USED);
+            }
+
+            float ClusterMetricsViewImpl::GetIdleTimePercentage()
+            {
+                return Read<int64_t>(ClusterMetricsLayout::TOTAL_IDLE_TIME) /
+                    (float)Read<int64_t>(ClusterMetricsLayout::UPTIME);
+            }
+
+            int64_t ClusterMetricsViewImpl::GetLastDataVersion()
+            {
+                return Read<int64_t>(ClusterMetricsLayout::LAST_DATA_VERSION);
+            }
+
+            Timestamp ClusterMetricsViewImpl::GetLastUpdateTime()
+            {
+                return ReadTimestamp(ClusterMetricsLayout::LAST_UPDATE_TIME);
+            }
+
+            int32_t ClusterMetricsViewImpl::GetMaximumActiveJobs()
+            {
+                return Read<int32_t>(ClusterMetricsLayout::MAXIMUM_ACTIVE_JOBS);
+            }
+
+            int32_t ClusterMetricsViewImpl::GetMaximumCancelledJobs()
+            {
+                return Read<int32_t>(ClusterMetricsLayout::MAXIMUM_CANCELLED_JOBS);
+            }
+
+            int64_t ClusterMetricsViewImpl::GetMaximumJobExecuteTime()
+            {
+                return Read<int64_t>(ClusterMetricsLayout::MAXIMUM_JOB_EXECUTE_TIME);
+            }
+
+            int64_t ClusterMetricsViewImpl::GetMaximumJobWaitTime()
+            {
+                return Read<int64_t>(ClusterMetricsLayout::MAXIMUM_JOB_WAIT_TIME);
+            }
+
+            int32_t ClusterMetricsViewImpl::GetMaximumRejectedJobs()
+            {
+                return Read<int32_t>(ClusterMetricsLayout::MAXIMUM_REJECTED_JOBS);
+            }
+
+            int32_t ClusterMetricsViewImpl::GetMaximumThreadCount()
+            {
+                return Read<int32_t>(ClusterMetricsLayout::MAXIMUM_THREAD_COUNT);
+            }
+
+            int32_t ClusterMetricsViewImpl::GetMaximumWaitingJobs()
+            {
+                return Read<int32_t>(ClusterMetricsLayout::MAXIMUM_WAITING_JOBS);
+            }
+
+            Timestamp ClusterMetricsViewImpl::GetNodeStartTime()
+            {
+                return ReadTimestamp(ClusterMetricsLayout::NODE_START_TIME);
+            }
+
+            int64_t ClusterMetricsViewImpl::GetNonHeapMemoryCommitted()
+            {
+                return Read<int64_t>(ClusterMetricsLayout::NON_HEAP_MEMORY_COMMITTED);
+            }
+
+            int64_t ClusterMetricsViewImpl::GetNonHeapMemoryInitialized()
+            {
+                return Read<int64_t>(ClusterMetricsLayout::NON_HEAP_MEMORY_INITIALIZED);
+            }
+
+            int64_t ClusterMetricsViewImpl::GetNonHeapMemoryMaximum()
+            {
+                return Read<int64_t>(ClusterMetricsLayout::NON_HEAP_MEMORY_MAXIMUM);
+            }
+
+            int64_t ClusterMetricsViewImpl::GetNonHeapMemoryTotal()
+            {
+                return Read<int64_t>(ClusterMetricsLayout::NON_HEAP_MEMORY_TOTAL);
+            }
+
+            int64_t ClusterMetricsViewImpl::GetNonHeapMemoryUsed()
+            {
+                return Read<int64_t>(ClusterMetricsLayout::NON_HEAP_MEMORY_USED);
+            }
+
+            int32_t ClusterMetricsViewImpl::GetOutboundMessagesQueueSize()
+            {
+                return Read<int32_t>(ClusterMetricsLayout::OUTBOUND_MESSAGES_QUEUE_SIZE);
+            }
+
+            int64_t ClusterMetricsViewImpl::GetReceivedBytesCount()
+            {
+                return Read<int64_t>(ClusterMetricsLayout::RECEIVED_BYTES_COUNT);
+            }
+
+            int32_t ClusterMetricsViewImpl::GetReceivedMessagesCount()
+            {
+                return Read<int32_t>(ClusterMetricsLayout::RECEIVED_MESSAGES_COUNT);
+            }
+
+            int64_t ClusterMetricsViewImpl::GetSentBytesCount()
+            {
+                return Read<int64_t>(ClusterMetricsLayout::SENT_BYTES_COUNT);
+            }
+
+            int32_t ClusterMetricsViewImpl::GetSentMessagesCount()
+            {
+                return Read<int32_t>(ClusterMetricsLayout::SENT_MESSAGES_COUNT);
+            }
+
+            Timestamp ClusterMetricsViewImpl::GetStartTime()
+            {
+                return ReadTimestamp(ClusterMetricsLayout::START_TIME);
+            }
+
+            int64_t ClusterMetricsViewImpl::GetTotalBusyTime()
+            {
+                return Read<int64_t>(ClusterMetricsLayout::UPTIME) - Read<int64_t>(ClusterMetricsLayout::TOTAL_IDLE_TIME);
+            }
+
+            int32_t ClusterMetricsViewImpl::GetTotalCancelledJobs()
+            {
+                return Read<int32_t>(ClusterMetricsLayout::TOTAL_CANCELLED_JOBS);
+            }
+
+            int32_t ClusterMetricsViewImpl::GetTotalCpus()
+            {
+                return Read<int32_t>(ClusterMetricsLayout::TOTAL_CPUS);
+            }
+
+            int32_t ClusterMetricsViewImpl::GetTotalExecutedJobs()
+            {
+                return Read<int32_t>(ClusterMetricsLayout::TOTAL_EXECUTED_JOBS);
+            }
+
+            int32_t ClusterMetricsViewImpl::GetTotalExecutedTasks()
+            {
+                return Read<int32_t>(ClusterMetricsLayout::TOTAL_EXECUTED_TASKS);
+            }
+
+            int64_t ClusterMetricsViewImpl::GetTotalIdleTime()
+            {
+                return Read<int64_t>(ClusterMetricsLayout::TOTAL_IDLE_TIME);
+            }
+
+            int32_t ClusterMetricsViewImpl::GetTotalNodes()
+            {
+                return Read<int32_t>(ClusterMetricsLayout::TOTAL_NODES);
+            }
+
+            int64_t ClusterMetricsViewImpl::GetTotalRejectedJobs()
+            {
+                return Read<int32_t>(ClusterMetricsLayout::TOTAL_REJECTED_JOBS);
+            }
+
+            int64_t ClusterMetricsViewImpl::GetTotalStartedThreadCount()
+            {
+                return Read<int64_t>(ClusterMetricsLayout::TOTAL_STARTED_THREAD_COUNT);
+            }
+
+            int64_t ClusterMetricsViewImpl::GetUpTime()
+            {
+                return Read<int64_t>(ClusterMetricsLayout::UPTIME);
+            }
+        }
+    }
+}
\ No newline at end of file
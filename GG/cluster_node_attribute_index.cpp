@@ -0,0 +1,174 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+
+#include <ignite/ignite_error.h>
+
+#include <ignite/impl/binary/binary_common.h>
+#include <ignite/impl/cluster/cluster_node_attribute_index.h>
+
+using namespace ignite::impl::binary;
+using namespace ignite::impl::interop;
+
+namespace
+{
+    /**
+     * Check whether the entries have the same name ID.
+     *
+     * @param lhs First entry.
+     * @param rhs Second entry.
+     * @return True if the name IDs are equal.
+     */
+    template<typename E>
+    bool SameName(const E& lhs, const E& rhs)
+    {
+        return lhs.nameId == rhs.nameId;
+    }
+}
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cluster
+        {
+            ClusterNodeAttributeIndex::ClusterNodeAttributeIndex()
+            {
+                // No-op.
+            }
+
+            void ClusterNodeAttributeIndex::Read(BinaryReaderImpl& reader, const int8_t* data)
+            {
+                entries.clear();
+
+                InteropInputStream* stream = reader.GetStream();
+
+                int32_t cnt = reader.ReadInt32();
+
+                if (cnt <= 0)
+                    return;
+
+                // Every attribute takes at least a name header, a name length and a value header.
+                if (cnt > stream->Remaining() / 6)
+                {
+                    IGNITE_ERROR_FORMATTED_1(IgniteError::IGNITE_ERR_BINARY, "Corrupted node attributes",
+                        "count", cnt)
+                }
+
+                std::vector<ClusterNodeAttributeNames::NameRef> refs(cnt);
+
+                entries.resize(cnt);
+
+                for (int32_t i = 0; i < cnt; ++i)
+                {
+                    int32_t pos = stream->Position();
+                    int8_t hdr = stream->ReadInt8();
+
+                    if (hdr != IGNITE_TYPE_STRING)
+                    {
+                        IGNITE_ERROR_FORMATTED_2(IgniteError::IGNITE_ERR_BINARY, "Unexpected attribute name header",
+                            "position", pos, "header", static_cast<int32_t>(hdr))
+                    }
+
+                    int32_t len = stream->ReadInt32();
+
+                    if (len < 0 || len > stream->Remaining())
+                    {
+                        IGNITE_ERROR_FORMATTED_1(IgniteError::IGNITE_ERR_BINARY, "Corrupted attribute name",
+                            "position", pos)
+                    }
+
+                    refs[i].bytes = data + stream->Position();
+                    refs[i].len = len;
+
+                    stream->Ignore(len);
+
+                    entries[i].valueOffset = stream->Position();
+
+                    reader.Skip();
+                }
+
+                std::vector<int32_t> ids;
+
+                ClusterNodeAttributeNames::GetInstance().Intern(refs, ids);
+
+                for (int32_t i = 0; i < cnt; ++i)
+                    entries[i].nameId = ids[i];
+
+                // Sort is stable and unique keeps the first entry of a run, so the first of
+                // the duplicate names wins.
+                std::stable_sort(entries.begin(), entries.end());
+
+                entries.erase(std::unique(entries.begin(), entries.end(), SameName<Entry>), entries.end());
+            }
+
+            int32_t ClusterNodeAttributeIndex::Find(const std::string& name) const
+            {
+                if (entries.empty())
+                    return -1;
+
+                int32_t nameId = ClusterNodeAttributeNames::GetInstance().Find(name);
+
+                if (nameId < 0)
+                    return -1;
+
+                return Find(nameId);
+            }
+
+            int32_t ClusterNodeAttributeIndex::Find(int32_t nameId) const
+            {
+                Entry key;
+
+                key.nameId = nameId;
+                key.valueOffset = 0;
+
+                std::vector<Entry>::const_iterator it = std::lower_bound(entries.begin(), entries.end(), key);
+
+                if (it == entries.end() || it->nameId != nameId)
+                    return -1;
+
+                return static_cast<int32_t>(it - entries.begin());
+            }
+
+            void ClusterNodeAttributeIndex::Retain(const std::vector<int32_t>& nameIds)
+            {
+                std::vector<Entry> retained;
+
+                std::vector<int32_t>::const_iterator id = nameIds.begin();
+
+                for (std::vector<Entry>::const_iterator it = entries.begin(); it != entries.end(); ++it)
+                {
+                    while (id != nameIds.end() && *id < it->nameId)
+                        ++id;
+
+                    if (id == nameIds.end())
+                        break;
+
+                    if (*id == it->nameId)
+                        retained.push_back(*it);
+                }
+
+                entries.swap(retained);
+            }
+
+            std::string ClusterNodeAttributeIndex::GetName(int32_t idx) const
+            {
+                return ClusterNodeAttributeNames::GetInstance().GetName(entries[idx].nameId);
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,179 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _IGNITE_CLUSTER_CLUSTER_NODE_ATTRIBUTE_INDEX
+#define _IGNITE_CLUSTER_CLUSTER_NODE_ATTRIBUTE_INDEX
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include <ignite/common/common.h>
+
+#include <ignite/impl/binary/binary_reader_impl.h>
+#include <ignite/impl/cluster/cluster_node_attribute_names.h>
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cluster
+        {
+            /**
+             * Index of the Cluster Node attributes.
+             *
+             * Attribute names are interned in the process-wide ClusterNodeAttributeNames
+             * dictionary, so the index holds only pairs of the name ID and the offset of the
+             * value within the node payload. Pairs are sorted by the name ID and looked up
+             * with binary search.
+             */
+            class IGNITE_FRIEND_EXPORT ClusterNodeAttributeIndex
+            {
+            public:
+                /**
+                 * Constructor.
+                 */
+                ClusterNodeAttributeIndex();
+
+                /**
+                 * Read attributes and build the index.
+                 *
+                 * @param reader Reader positioned at the attributes count.
+                 * @param data Payload the reader stream is created over.
+                 */
+                void Read(binary::BinaryReaderImpl& reader, const int8_t* data);
+
+                /**
+                 * Get number of attributes.
+                 *
+                 * @return Number of attributes.
+                 */
+                int32_t GetSize() const
+                {
+                    return static_cast<int32_t>(entries.size());
+                }
+
+                /**
+                 * Find attribute.
+                 *
+                 * @param name Attribute name.
+                 * @return Position of the attribute or -1 if there is no attribute
+                 *     with the given name.
+                 */
+                int32_t Find(const std::string& name) const;
+
+                /**
+                 * Find attribute by the name ID.
+                 *
+                 * @param nameId Name ID in the ClusterNodeAttributeNames dictionary.
+                 * @return Position of the attribute or -1 if there is no attribute
+                 *     with the given name.
+                 */
+                int32_t Find(int32_t nameId) const;
+
+                /**
+                 * Get attribute name ID.
+                 *
+                 * @param idx Position of the attribute.
+                 * @return Name ID in the ClusterNodeAttributeNames dictionary.
+                 */
+                int32_t GetNameId(int32_t idx) const
+                {
+                    return entries[idx].nameId;
+                }
+
+                /**
+                 * Get attribute name.
+                 *
+                 * @param idx Position of the attribute.
+                 * @return Attribute name.
+                 */
+                std::string GetName(int32_t idx) const;
+
+                /**
+                 * Get offset of the attribute value.
+                 *
+                 * @param idx Position of the attribute.
+                 * @return Offset of the value header in the payload.
+                 */
+                int32_t GetValueOffset(int32_t idx) const
+                {
+                    return entries[idx].valueOffset;
+                }
+
+                /**
+                 * Set offset of the attribute value. Used when the values are moved to
+                 * another buffer.
+                 *
+                 * @param idx Position of the attribute.
+                 * @param offset Offset of the value header in the new buffer.
+                 */
+                void SetValueOffset(int32_t idx, int32_t offset)
+                {
+                    entries[idx].valueOffset = offset;
+                }
+
+                /**
+                 * Keep only the given attributes and release memory of the rest.
+                 *
+                 * @param nameIds Sorted name IDs of the attributes to keep.
+                 */
+                void Retain(const std::vector<int32_t>& nameIds);
+
+                /**
+                 * Get memory used by the index.
+                 *
+                 * @return Memory in bytes.
+                 */
+                int64_t GetMemoryUsage() const
+                {
+                    return static_cast<int64_t>(entries.capacity() * sizeof(Entry));
+                }
+
+            private:
+                IGNITE_NO_COPY_ASSIGNMENT(ClusterNodeAttributeIndex);
+
+                /**
+                 * Index entry.
+                 */
+                struct Entry
+                {
+                    /** Name ID. */
+                    int32_t nameId;
+
+                    /** Offset of the value header. */
+                    int32_t valueOffset;
+
+                    /**
+                     * Compare entries by the name ID.
+                     *
+                     * @param other Other entry.
+                     * @return True if this entry goes first.
+                     */
+                    bool operator<(const Entry& other) const
+                    {
+                        return nameId < other.nameId;
+                    }
+                };
+
+                /** Entries sorted by the name ID. */
+                std::vector<Entry> entries;
+            };
+        }
+    }
+}
+
+#endif //_IGNITE_CLUSTER_CLUSTER_NODE_ATTRIBUTE_INDEX
\ No newline at end of file
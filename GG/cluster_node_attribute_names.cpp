@@ -0,0 +1,225 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef _WIN32
+#   include <windows.h>
+#endif
+
+#include <cstring>
+
+#include <ignite/ignite_error.h>
+
+#include <ignite/impl/cluster/cluster_node_attribute_names.h>
+
+using namespace ignite::common::concurrent;
+
+namespace
+{
+    /** Initial size of the lookup table. */
+    const size_t INITIAL_SLOTS = 256;
+
+    /** Dictionary instance. Constructed during static initialization. */
+    ignite::impl::cluster::ClusterNodeAttributeNames instance;
+
+    /**
+     * Full memory barrier.
+     */
+    void Fence()
+    {
+#ifdef _WIN32
+        MemoryBarrier();
+#else
+        __sync_synchronize();
+#endif
+    }
+}
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cluster
+        {
+            ClusterNodeAttributeNames& ClusterNodeAttributeNames::GetInstance()
+            {
+                return instance;
+            }
+
+            ClusterNodeAttributeNames::ClusterNodeAttributeNames() :
+                size(0),
+                table(new Table(INITIAL_SLOTS))
+            {
+                memset(chunks, 0, sizeof(chunks));
+            }
+
+            ClusterNodeAttributeNames::~ClusterNodeAttributeNames()
+            {
+                for (int32_t i = 0; i < MAX_CHUNKS; ++i)
+                    delete[] chunks[i];
+
+                for (size_t i = 0; i < retired.size(); ++i)
+                    delete retired[i];
+
+                delete table;
+            }
+
+            void ClusterNodeAttributeNames::Intern(const std::vector<NameRef>& refs, std::vector<int32_t>& ids)
+            {
+                ids.resize(refs.size());
+
+                CsLockGuard guard(lock);
+
+                for (size_t i = 0; i < refs.size(); ++i)
+                {
+                    const NameRef& ref = refs[i];
+
+                    uint32_t hash = Hash(ref.bytes, ref.len);
+                    size_t slot = FindSlot(*table, hash, ref.bytes, ref.len);
+
+                    if (table->slots[slot] == -1)
+                    {
+                        int32_t id = size;
+
+                        if (id == MAX_NAMES)
+                        {
+                            IGNITE_ERROR_FORMATTED_1(IgniteError::IGNITE_ERR_ILLEGAL_STATE,
+                                "Too many distinct node attribute names", "max", MAX_NAMES)
+                        }
+
+                        // Keep the load factor of the table at most 1/2.
+                        if ((static_cast<size_t>(id) + 1) * 2 > table->slots.size())
+                        {
+                            Grow();
+
+                            slot = FindSlot(*table, hash, ref.bytes, ref.len);
+                        }
+
+                        if (id % CHUNK_SIZE == 0)
+                            chunks[id / CHUNK_SIZE] = new Entry[CHUNK_SIZE];
+
+                        Entry& entry = chunks[id / CHUNK_SIZE][id % CHUNK_SIZE];
+
+                        entry.name.assign(reinterpret_cast<const char*>(ref.bytes), ref.len);
+                        entry.hash = hash;
+
+                        // The entry has to be complete before readers can reach it.
+                        Fence();
+
+                        table->slots[slot] = id;
+
+                        // Every name counted by GetSize() can be found.
+                        Fence();
+
+                        size = id + 1;
+                    }
+
+                    ids[i] = table->slots[slot];
+                }
+            }
+
+            int32_t ClusterNodeAttributeNames::Find(const std::string& name) const
+            {
+                const int8_t* bytes = reinterpret_cast<const int8_t*>(name.data());
+                int32_t len = static_cast<int32_t>(name.size());
+
+                uint32_t hash = Hash(bytes, len);
+
+                const Table* current = table;
+
+                Fence();
+
+                return current->slots[FindSlot(*current, hash, bytes, len)];
+            }
+
+            std::string ClusterNodeAttributeNames::GetName(int32_t id) const
+            {
+                return GetEntry(id).name;
+            }
+
+            int32_t ClusterNodeAttributeNames::GetSize() const
+            {
+                return size;
+            }
+
+            uint32_t ClusterNodeAttributeNames::Hash(const int8_t* bytes, int32_t len)
+            {
+                // FNV-1a.
+                uint32_t hash = 2166136261U;
+
+                for (int32_t i = 0; i < len; ++i)
+                {
+                    hash ^= static_cast<uint8_t>(bytes[i]);
+                    hash *= 16777619U;
+                }
+
+                return hash;
+            }
+
+            size_t ClusterNodeAttributeNames::FindSlot(const Table& table, uint32_t hash, const int8_t* bytes,
+                int32_t len) const
+            {
+                // Slots change concurrently from -1 to an ID, so every one of them is read once.
+                const volatile int32_t* slots = &table.slots[0];
+
+                size_t mask = table.slots.size() - 1;
+                size_t slot = hash & mask;
+
+                while (true)
+                {
+                    int32_t id = slots[slot];
+
+                    if (id == -1)
+                        break;
+
+                    const Entry& entry = GetEntry(id);
+
+                    if (entry.hash == hash && entry.name.size() == static_cast<size_t>(len) &&
+                        memcmp(entry.name.data(), bytes, len) == 0)
+                        break;
+
+                    slot = (slot + 1) & mask;
+                }
+
+                return slot;
+            }
+
+            void ClusterNodeAttributeNames::Grow()
+            {
+                Table* current = table;
+                Table* grown = new Table(current->slots.size() * 2);
+
+                size_t mask = grown->slots.size() - 1;
+
+                for (int32_t id = 0; id < size; ++id)
+                {
+                    size_t slot = GetEntry(id).hash & mask;
+
+                    while (grown->slots[slot] != -1)
+                        slot = (slot + 1) & mask;
+
+                    grown->slots[slot] = id;
+                }
+
+                // Readers which have already picked the current table keep using it.
+                retired.push_back(current);
+
+                Fence();
+
+                table = grown;
+            }
+        }
+    }
+}
\ No newline at end of file
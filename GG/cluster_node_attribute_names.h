@@ -0,0 +1,212 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _IGNITE_CLUSTER_CLUSTER_NODE_ATTRIBUTE_NAMES
+#define _IGNITE_CLUSTER_CLUSTER_NODE_ATTRIBUTE_NAMES
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include <ignite/common/common.h>
+#include <ignite/common/concurrent.h>
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cluster
+        {
+            /**
+             * Process-wide dictionary of the Cluster Node attribute names.
+             *
+             * Nodes carry mostly the same attribute names, so every distinct name is stored
+             * once and is identified by an integer ID which never changes and is never
+             * reused. Names are never removed from the dictionary.
+             *
+             * The dictionary is read far more often than it is changed, so lookups take no
+             * locks. Names are stored in chunks which never move, and lookup slots only ever
+             * change from empty to a name ID. When the lookup table grows, a new one is built
+             * and published, and the old one is kept until the dictionary is destroyed, so
+             * that concurrent readers can finish with it. Retired tables take less memory than
+             * the current one.
+             *
+             * The dictionary holds at most MAX_NAMES names. Interning more distinct names fails.
+             */
+            class IGNITE_FRIEND_EXPORT ClusterNodeAttributeNames
+            {
+            public:
+                /**
+                 * Reference to the name bytes.
+                 */
+                struct NameRef
+                {
+                    /** UTF-8 bytes. */
+                    const int8_t* bytes;
+
+                    /** Length in bytes. */
+                    int32_t len;
+                };
+
+                /**
+                 * Get the dictionary instance.
+                 *
+                 * @return Dictionary.
+                 */
+                static ClusterNodeAttributeNames& GetInstance();
+
+                /** Number of names in a storage chunk. */
+                static const int32_t CHUNK_SIZE = 1024;
+
+                /** Maximum number of storage chunks. */
+                static const int32_t MAX_CHUNKS = 64;
+
+                /** Maximum number of names. */
+                static const int32_t MAX_NAMES = CHUNK_SIZE * MAX_CHUNKS;
+
+                /**
+                 * Constructor.
+                 */
+                ClusterNodeAttributeNames();
+
+                /**
+                 * Destructor.
+                 */
+                ~ClusterNodeAttributeNames();
+
+                /**
+                 * Get IDs of the names adding the ones which are not in the dictionary yet.
+                 *
+                 * @param refs Names.
+                 * @param ids Name IDs in the same order as the names.
+                 * @throw IgniteError if the dictionary is full.
+                 */
+                void Intern(const std::vector<NameRef>& refs, std::vector<int32_t>& ids);
+
+                /**
+                 * Get ID of the name.
+                 *
+                 * @param name Name.
+                 * @return Name ID or -1 if the name is not in the dictionary.
+                 */
+                int32_t Find(const std::string& name) const;
+
+                /**
+                 * Get name by ID.
+                 *
+                 * @param id Name ID.
+                 * @return Name.
+                 */
+                std::string GetName(int32_t id) const;
+
+                /**
+                 * Get number of names.
+                 *
+                 * @return Number of names.
+                 */
+                int32_t GetSize() const;
+
+            private:
+                IGNITE_NO_COPY_ASSIGNMENT(ClusterNodeAttributeNames);
+
+                /**
+                 * Stored name.
+                 */
+                struct Entry
+                {
+                    /** Name. */
+                    std::string name;
+
+                    /** Name hash. */
+                    uint32_t hash;
+                };
+
+                /**
+                 * Lookup table of the name IDs. Empty slots are -1.
+                 */
+                struct Table
+                {
+                    /**
+                     * Constructor.
+                     *
+                     * @param size Number of slots. Must be a power of two.
+                     */
+                    explicit Table(size_t size) :
+                        slots(size, -1)
+                    {
+                        // No-op.
+                    }
+
+                    /** Slots. Size never changes once the table is published. */
+                    std::vector<int32_t> slots;
+                };
+
+                /**
+                 * Calculate hash of the name bytes.
+                 *
+                 * @param bytes Name bytes.
+                 * @param len Length.
+                 * @return Hash.
+                 */
+                static uint32_t Hash(const int8_t* bytes, int32_t len);
+
+                /**
+                 * Get stored name.
+                 *
+                 * @param id Name ID.
+                 * @return Stored name.
+                 */
+                const Entry& GetEntry(int32_t id) const
+                {
+                    return chunks[id / CHUNK_SIZE][id % CHUNK_SIZE];
+                }
+
+                /**
+                 * Find the slot of the name in the lookup table.
+                 *
+                 * @param table Lookup table.
+                 * @param hash Name hash.
+                 * @param bytes Name bytes.
+                 * @param len Length.
+                 * @return Slot holding the name or the empty slot it should be put into.
+                 */
+                size_t FindSlot(const Table& table, uint32_t hash, const int8_t* bytes, int32_t len) const;
+
+                /**
+                 * Publish a lookup table of double size.
+                 */
+                void Grow();
+
+                /** Lock serializing writers. */
+                common::concurrent::CriticalSection lock;
+
+                /** Storage chunks. Allocated on demand and never moved. */
+                Entry* chunks[MAX_CHUNKS];
+
+                /** Number of published names. */
+                volatile int32_t size;
+
+                /** Current lookup table. */
+                Table* volatile table;
+
+                /** Lookup tables replaced by the bigger ones. */
+                std::vector<Table*> retired;
+            };
+        }
+    }
+}
+
+#endif //_IGNITE_CLUSTER_CLUSTER_NODE_ATTRIBUTE_NAMES
\ No newline at end of file
@@ -0,0 +1,94 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+ /**
+  * @file
+  * Declares ignite::cluster::ClusterNodeLoadWeights class.
+  */
+
+#ifndef _IGNITE_CLUSTER_CLUSTER_NODE_LOAD_WEIGHTS
+#define _IGNITE_CLUSTER_CLUSTER_NODE_LOAD_WEIGHTS
+
+namespace ignite
+{
+    namespace cluster
+    {
+        /**
+         * Weights of the node metrics in the node load.
+         *
+         * Load of a node is the weighted sum of its current CPU load, number of waiting
+         * jobs, heap usage and size of the outbound messages queue. CPU load and heap
+         * usage are fractions from 0 to 1, the others are counts, so the weights also
+         * bring the metrics to the same scale.
+         *
+         * Every pick of a node also counts as a job assigned to it until the next
+         * snapshot of the node arrives, so that picks made between two refreshes are
+         * spread over the nodes instead of all going to the same one.
+         */
+        struct ClusterNodeLoadWeights
+        {
+            /**
+             * Constructor. All the weights are set to 1.
+             */
+            ClusterNodeLoadWeights() :
+                cpuLoad(1.0),
+                waitingJobs(1.0),
+                heapUsage(1.0),
+                outboundMessagesQueueSize(1.0),
+                assignedJobs(1.0)
+            {
+                // No-op.
+            }
+
+            /**
+             * Constructor.
+             *
+             * @param cpuLoad Weight of the current CPU load.
+             * @param waitingJobs Weight of the current number of waiting jobs.
+             * @param heapUsage Weight of the used to maximum heap memory ratio.
+             * @param outboundMessagesQueueSize Weight of the outbound messages queue size.
+             * @param assignedJobs Weight of the number of picks since the last snapshot.
+             */
+            ClusterNodeLoadWeights(double cpuLoad, double waitingJobs, double heapUsage,
+                double outboundMessagesQueueSize, double assignedJobs = 1.0) :
+                cpuLoad(cpuLoad),
+                waitingJobs(waitingJobs),
+                heapUsage(heapUsage),
+                outboundMessagesQueueSize(outboundMessagesQueueSize),
+                assignedJobs(assignedJobs)
+            {
+                // No-op.
+            }
+
+            /** Weight of the current CPU load. */
+            double cpuLoad;
+
+            /** Weight of the current number of waiting jobs. */
+            double waitingJobs;
+
+            /** Weight of the used to maximum heap memory ratio. */
+            double heapUsage;
+
+            /** Weight of the outbound messages queue size. */
+            double outboundMessagesQueueSize;
+
+            /** Weight of the number of picks since the last snapshot. */
+            double assignedJobs;
+        };
+    }
+}
+
+#endif //_IGNITE_CLUSTER_CLUSTER_NODE_LOAD_WEIGHTS
\ No newline at end of file
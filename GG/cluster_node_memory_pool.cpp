@@ -0,0 +1,160 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdlib>
+#include <cstring>
+
+#include <ignite/ignite_error.h>
+
+#include <ignite/impl/cluster/cluster_node_memory_pool.h>
+
+using namespace ignite::common::concurrent;
+using namespace ignite::impl::interop;
+
+namespace
+{
+    /** Payload alignment within a slab. */
+    const int32_t PAYLOAD_ALIGNMENT = 8;
+
+    /** Pool instance. Constructed during static initialization. */
+    ignite::impl::cluster::ClusterNodeMemoryPool instance;
+}
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cluster
+        {
+            ClusterNodeMemorySlab::ClusterNodeMemorySlab(int32_t size) :
+                data(static_cast<int8_t*>(malloc(size > 0 ? size : 1))),
+                size(size),
+                live(0)
+            {
+                if (!data)
+                    IGNITE_ERROR_1(IgniteError::IGNITE_ERR_MEMORY, "Failed to allocate memory for node payload");
+            }
+
+            ClusterNodeMemorySlab::~ClusterNodeMemorySlab()
+            {
+                free(data);
+            }
+
+            void ClusterNodeMemorySlab::AddLive(int32_t len)
+            {
+                int32_t old;
+
+                do
+                {
+                    old = Atomics::CompareAndSet32Val(&live, 0, 0);
+                }
+                while (!Atomics::CompareAndSet32(&live, old, old + len));
+            }
+
+            int32_t ClusterNodeMemorySlab::GetLive()
+            {
+                return Atomics::CompareAndSet32Val(&live, 0, 0);
+            }
+
+            ClusterNodeMemory::ClusterNodeMemory(const SharedPointer<ClusterNodeMemorySlab>& slab,
+                int32_t offset, int32_t len) :
+                slab(slab)
+            {
+                memPtr = reinterpret_cast<int8_t*>(hdr);
+
+                Data(memPtr, slab.Get()->Data() + offset);
+                Capacity(memPtr, len);
+                Length(memPtr, len);
+                Flags(memPtr, 0);
+
+                this->slab.Get()->AddLive(len);
+            }
+
+            ClusterNodeMemory::~ClusterNodeMemory()
+            {
+                slab.Get()->AddLive(-Length());
+            }
+
+            void ClusterNodeMemory::Reallocate(int32_t)
+            {
+                IGNITE_ERROR_1(IgniteError::IGNITE_ERR_UNSUPPORTED_OPERATION, "Node payload memory is read-only");
+            }
+
+            int64_t ClusterNodeMemory::GetSlabShare()
+            {
+                int32_t len = Length();
+                int32_t live = slab.Get()->GetLive();
+
+                if (live < len)
+                    live = len;
+
+                return live > 0 ? static_cast<int64_t>(slab.Get()->GetSize()) * len / live : 0;
+            }
+
+            ClusterNodeMemoryPool& ClusterNodeMemoryPool::GetInstance()
+            {
+                return instance;
+            }
+
+            ClusterNodeMemoryPool::ClusterNodeMemoryPool(int32_t slabSize) :
+                slabSize(slabSize)
+            {
+                // No-op.
+            }
+
+            SharedPointer<InteropMemory> ClusterNodeMemoryPool::Copy(InteropMemory& src)
+            {
+                return Copy(src, payloads);
+            }
+
+            SharedPointer<InteropMemory> ClusterNodeMemoryPool::CopyRetained(InteropMemory& src)
+            {
+                return Copy(src, retained);
+            }
+
+            SharedPointer<InteropMemory> ClusterNodeMemoryPool::Copy(InteropMemory& src, Arena& arena)
+            {
+                int32_t len = src.Length();
+
+                SharedPointer<ClusterNodeMemorySlab> dst;
+                int32_t offset = 0;
+
+                if (len > slabSize / 4)
+                    dst = SharedPointer<ClusterNodeMemorySlab>(new ClusterNodeMemorySlab(len));
+                else
+                {
+                    CsLockGuard guard(lock);
+
+                    if (!arena.slab.IsValid() || slabSize - arena.used < len)
+                    {
+                        arena.slab = SharedPointer<ClusterNodeMemorySlab>(new ClusterNodeMemorySlab(slabSize));
+                        arena.used = 0;
+                    }
+
+                    dst = arena.slab;
+                    offset = arena.used;
+
+                    arena.used += (len + PAYLOAD_ALIGNMENT - 1) & ~(PAYLOAD_ALIGNMENT - 1);
+                }
+
+                // Region is reserved, so the copy is done outside of the lock.
+                memcpy(dst.Get()->Data() + offset, src.Data(), len);
+
+                return SharedPointer<InteropMemory>(new ClusterNodeMemory(dst, offset, len));
+            }
+        }
+    }
+}
\ No newline at end of file
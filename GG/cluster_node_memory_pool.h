@@ -0,0 +1,250 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _IGNITE_CLUSTER_CLUSTER_NODE_MEMORY_POOL
+#define _IGNITE_CLUSTER_CLUSTER_NODE_MEMORY_POOL
+
+#include <stdint.h>
+
+#include <ignite/common/common.h>
+#include <ignite/common/concurrent.h>
+
+#include <ignite/impl/interop/interop_memory.h>
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cluster
+        {
+            /**
+             * Slab of memory shared by several node payloads.
+             */
+            class ClusterNodeMemorySlab
+            {
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param size Size in bytes.
+                 */
+                explicit ClusterNodeMemorySlab(int32_t size);
+
+                /**
+                 * Destructor.
+                 */
+                ~ClusterNodeMemorySlab();
+
+                /**
+                 * Get slab data.
+                 *
+                 * @return Data.
+                 */
+                int8_t* Data()
+                {
+                    return data;
+                }
+
+                /**
+                 * Get slab size.
+                 *
+                 * @return Size in bytes.
+                 */
+                int32_t GetSize() const
+                {
+                    return size;
+                }
+
+                /**
+                 * Add bytes of a payload placed in the slab to the live bytes.
+                 *
+                 * @param len Payload length.
+                 */
+                void AddLive(int32_t len);
+
+                /**
+                 * Get number of bytes of the payloads which are still in use.
+                 *
+                 * @return Live bytes.
+                 */
+                int32_t GetLive();
+
+            private:
+                IGNITE_NO_COPY_ASSIGNMENT(ClusterNodeMemorySlab);
+
+                /** Data. */
+                int8_t* data;
+
+                /** Size. */
+                int32_t size;
+
+                /** Bytes of the payloads which are still in use. */
+                int32_t live;
+            };
+
+            /**
+             * Read-only memory holding a node payload within a slab.
+             *
+             * Slab is released when the last memory placed in it is destroyed.
+             */
+            class ClusterNodeMemory : public interop::InteropMemory
+            {
+            public:
+                /**
+                 * Constructor.
+                 *
+                 * @param slab Slab.
+                 * @param offset Offset of the payload in the slab.
+                 * @param len Payload length.
+                 */
+                ClusterNodeMemory(const common::concurrent::SharedPointer<ClusterNodeMemorySlab>& slab,
+                    int32_t offset, int32_t len);
+
+                /**
+                 * Destructor.
+                 */
+                virtual ~ClusterNodeMemory();
+
+                /**
+                 * Reallocate memory. Not supported, node payloads are never written.
+                 *
+                 * @param cap Capacity.
+                 * @throw IgniteError always.
+                 */
+                virtual void Reallocate(int32_t cap);
+
+                /**
+                 * Get share of the slab attributed to the payload.
+                 *
+                 * Slab memory, including the space left by the released payloads, is split
+                 * between the live payloads in proportion to their length, so the shares of
+                 * all the payloads in a slab add up to its size.
+                 *
+                 * @return Share in bytes.
+                 */
+                int64_t GetSlabShare();
+
+            private:
+                IGNITE_NO_COPY_ASSIGNMENT(ClusterNodeMemory);
+
+                /** Slab. */
+                common::concurrent::SharedPointer<ClusterNodeMemorySlab> slab;
+
+                /** Memory header. */
+                int64_t hdr[(IGNITE_MEM_HDR_SIZE + 7) / 8];
+            };
+
+            /**
+             * Allocator of the node payloads.
+             *
+             * Payload bytes in use are copied out of the interop memory, which is reused
+             * for the next callback, into slabs by bumping an offset. Small payloads share
+             * a slab, payloads larger than a quarter of the slab get a slab of their own.
+             * Slabs are reference-counted by the payloads placed in them, so nothing is
+             * freed one payload at a time and a topology change costs a few slab
+             * allocations instead of one allocation per node.
+             *
+             * Buffers retained by the nodes in place of their full payloads are placed in
+             * separate slabs. Full payloads of such nodes are released right after they are
+             * received, and keeping the long-lived buffers apart lets their slabs be freed
+             * instead of being pinned by the buffers.
+             */
+            class IGNITE_FRIEND_EXPORT ClusterNodeMemoryPool
+            {
+            public:
+                /** Default slab size. */
+                enum { DEFAULT_SLAB_SIZE = 64 * 1024 };
+
+                /**
+                 * Get the pool instance.
+                 *
+                 * @return Pool.
+                 */
+                static ClusterNodeMemoryPool& GetInstance();
+
+                /**
+                 * Constructor.
+                 *
+                 * @param slabSize Slab size in bytes.
+                 */
+                explicit ClusterNodeMemoryPool(int32_t slabSize = DEFAULT_SLAB_SIZE);
+
+                /**
+                 * Copy payload into the pool.
+                 *
+                 * @param src Memory holding the payload. Only Length() bytes are copied.
+                 * @return Memory holding the copy.
+                 */
+                common::concurrent::SharedPointer<interop::InteropMemory> Copy(interop::InteropMemory& src);
+
+                /**
+                 * Copy buffer retained by a node in place of its full payload into the pool.
+                 *
+                 * @param src Memory holding the buffer. Only Length() bytes are copied.
+                 * @return Memory holding the copy.
+                 */
+                common::concurrent::SharedPointer<interop::InteropMemory> CopyRetained(interop::InteropMemory& src);
+
+            private:
+                IGNITE_NO_COPY_ASSIGNMENT(ClusterNodeMemoryPool);
+
+                /**
+                 * Slab new payloads of a kind are placed in.
+                 */
+                struct Arena
+                {
+                    /**
+                     * Constructor.
+                     */
+                    Arena() :
+                        used(0)
+                    {
+                        // No-op.
+                    }
+
+                    /** Current slab. */
+                    common::concurrent::SharedPointer<ClusterNodeMemorySlab> slab;
+
+                    /** Number of bytes used in the current slab. */
+                    int32_t used;
+                };
+
+                /**
+                 * Copy payload into the arena.
+                 *
+                 * @param src Memory holding the payload. Only Length() bytes are copied.
+                 * @param arena Arena.
+                 * @return Memory holding the copy.
+                 */
+                common::concurrent::SharedPointer<interop::InteropMemory> Copy(interop::InteropMemory& src, Arena& arena);
+
+                /** Lock. */
+                common::concurrent::CriticalSection lock;
+
+                /** Slab size. */
+                int32_t slabSize;
+
+                /** Arena of the full payloads. */
+                Arena payloads;
+
+                /** Arena of the retained buffers. */
+                Arena retained;
+            };
+        }
+    }
+}
+
+#endif //_IGNITE_CLUSTER_CLUSTER_NODE_MEMORY_POOL
\ No newline at end of file
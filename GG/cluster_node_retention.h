@@ -0,0 +1,61 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+ /**
+  * @file
+  * Declares ignite::cluster::ClusterNodeRetention enum.
+  */
+
+#ifndef _IGNITE_CLUSTER_CLUSTER_NODE_RETENTION
+#define _IGNITE_CLUSTER_CLUSTER_NODE_RETENTION
+
+namespace ignite
+{
+    namespace cluster
+    {
+        /**
+         * What a Cluster Node keeps of the payload it is received with.
+         *
+         * Policy is applied to the nodes received after it is set.
+         */
+        struct ClusterNodeRetention
+        {
+            enum Type
+            {
+                /**
+                 * Keep the whole payload and decode values on access. All the attributes
+                 * are available. This is the default.
+                 */
+                PAYLOAD = 0,
+
+                /**
+                 * Decode addresses and host names when the node is received and drop the
+                 * payload. Only the consistent ID is kept in a compact side buffer. Node
+                 * attributes are not available.
+                 */
+                DECODED = 1,
+
+                /**
+                 * Same as DECODED, but the chosen attributes are kept in the side buffer
+                 * as well.
+                 */
+                ATTRIBUTES = 2
+            };
+        };
+    }
+}
+
+#endif //_IGNITE_CLUSTER_CLUSTER_NODE_RETENTION
\ No newline at end of file
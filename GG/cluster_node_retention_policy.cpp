@@ -0,0 +1,83 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+
+#include <ignite/impl/cluster/cluster_node_attribute_names.h>
+#include <ignite/impl/cluster/cluster_node_retention_policy.h>
+
+using namespace ignite::common::concurrent;
+using namespace ignite::cluster;
+
+namespace
+{
+    /** Policy instance. Constructed during static initialization. */
+    ignite::impl::cluster::ClusterNodeRetentionPolicy instance;
+}
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cluster
+        {
+            ClusterNodeRetentionPolicy& ClusterNodeRetentionPolicy::GetInstance()
+            {
+                return instance;
+            }
+
+            ClusterNodeRetentionPolicy::ClusterNodeRetentionPolicy() :
+                retention(ClusterNodeRetention::PAYLOAD)
+            {
+                // No-op.
+            }
+
+            void ClusterNodeRetentionPolicy::Set(ClusterNodeRetention::Type retention,
+                const std::vector<std::string>& attrs)
+            {
+                std::vector<ClusterNodeAttributeNames::NameRef> refs(attrs.size());
+
+                for (size_t i = 0; i < attrs.size(); ++i)
+                {
+                    refs[i].bytes = reinterpret_cast<const int8_t*>(attrs[i].data());
+                    refs[i].len = static_cast<int32_t>(attrs[i].size());
+                }
+
+                std::vector<int32_t> ids;
+
+                ClusterNodeAttributeNames::GetInstance().Intern(refs, ids);
+
+                std::sort(ids.begin(), ids.end());
+                ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+
+                CsLockGuard guard(lock);
+
+                this->retention = retention;
+
+                attrIds.swap(ids);
+            }
+
+            ClusterNodeRetention::Type ClusterNodeRetentionPolicy::Get(std::vector<int32_t>& attrIds)
+            {
+                CsLockGuard guard(lock);
+
+                attrIds = this->attrIds;
+
+                return retention;
+            }
+        }
+    }
+}
\ No newline at end of file
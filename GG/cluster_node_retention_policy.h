@@ -0,0 +1,86 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _IGNITE_CLUSTER_CLUSTER_NODE_RETENTION_POLICY
+#define _IGNITE_CLUSTER_CLUSTER_NODE_RETENTION_POLICY
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include <ignite/common/common.h>
+#include <ignite/common/concurrent.h>
+
+#include <ignite/cluster/cluster_node_retention.h>
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cluster
+        {
+            /**
+             * Process-wide retention policy of the Cluster Node payloads.
+             */
+            class IGNITE_FRIEND_EXPORT ClusterNodeRetentionPolicy
+            {
+            public:
+                /**
+                 * Get the policy instance.
+                 *
+                 * @return Policy.
+                 */
+                static ClusterNodeRetentionPolicy& GetInstance();
+
+                /**
+                 * Constructor.
+                 */
+                ClusterNodeRetentionPolicy();
+
+                /**
+                 * Set policy.
+                 *
+                 * @param retention Retention.
+                 * @param attrs Names of the attributes to keep with the ATTRIBUTES retention.
+                 */
+                void Set(ignite::cluster::ClusterNodeRetention::Type retention, const std::vector<std::string>& attrs);
+
+                /**
+                 * Get policy.
+                 *
+                 * @param attrIds Sorted name IDs of the attributes to keep with the ATTRIBUTES
+                 *     retention.
+                 * @return Retention.
+                 */
+                ignite::cluster::ClusterNodeRetention::Type Get(std::vector<int32_t>& attrIds);
+
+            private:
+                IGNITE_NO_COPY_ASSIGNMENT(ClusterNodeRetentionPolicy);
+
+                /** Lock. */
+                common::concurrent::CriticalSection lock;
+
+                /** Retention. */
+                ignite::cluster::ClusterNodeRetention::Type retention;
+
+                /** Sorted name IDs of the attributes to keep. */
+                std::vector<int32_t> attrIds;
+            };
+        }
+    }
+}
+
+#endif //_IGNITE_CLUSTER_CLUSTER_NODE_RETENTION_POLICY
\ No newline at end of file
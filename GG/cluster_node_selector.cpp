@@ -0,0 +1,292 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifdef _WIN32
+#   include <windows.h>
+#else
+#   include <time.h>
+#endif
+
+#include <ignite/impl/cluster/cluster_node_selector.h>
+
+using namespace ignite::common::concurrent;
+using namespace ignite::cluster;
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cluster
+        {
+            namespace
+            {
+                /**
+                 * Get current value of the monotonic clock.
+                 *
+                 * @return Time in milliseconds.
+                 */
+                int64_t GetMonotonicTimeMillis()
+                {
+#ifdef _WIN32
+                    return static_cast<int64_t>(GetTickCount64());
+#else
+                    timespec ts;
+                    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+                    return static_cast<int64_t>(ts.tv_sec) * 1000 + ts.tv_nsec / 1000000;
+#endif
+                }
+            }
+
+            ClusterNodeSelector::ClusterNodeSelector() :
+                maxAge(DEFAULT_MAX_AGE)
+            {
+                // No-op.
+            }
+
+            void ClusterNodeSelector::SetWeights(const ClusterNodeLoadWeights& weights)
+            {
+                CsLockGuard guard(lock);
+
+                this->weights = weights;
+
+                for (size_t i = 0; i < heap.size(); ++i)
+                    heap[i].load = GetLoad(heap[i]);
+
+                // Floyd's heap construction: sift down every inner node starting from the last one.
+                for (int32_t i = static_cast<int32_t>(heap.size()) / 2 - 1; i >= 0; --i)
+                    SiftDown(i);
+            }
+
+            ClusterNodeLoadWeights ClusterNodeSelector::GetWeights()
+            {
+                CsLockGuard guard(lock);
+
+                return weights;
+            }
+
+            void ClusterNodeSelector::SetMaxAge(int64_t maxAge)
+            {
+                CsLockGuard guard(lock);
+
+                this->maxAge = maxAge;
+            }
+
+            int64_t ClusterNodeSelector::GetMaxAge()
+            {
+                CsLockGuard guard(lock);
+
+                return maxAge;
+            }
+
+            void ClusterNodeSelector::Update(const Guid& id, ClusterMetricsImpl& metrics)
+            {
+                CsLockGuard guard(lock);
+
+                Put(id, metrics);
+            }
+
+            void ClusterNodeSelector::Update(const std::map<Guid, SP_ClusterMetricsImpl>& metrics)
+            {
+                CsLockGuard guard(lock);
+
+                for (std::map<Guid, SP_ClusterMetricsImpl>::const_iterator it = metrics.begin(); it != metrics.end(); ++it)
+                {
+                    SP_ClusterMetricsImpl node = it->second;
+
+                    Put(it->first, *node.Get());
+                }
+
+                // Removal reorders the heap, so the nodes to remove are collected first.
+                std::vector<Guid> left;
+
+                for (std::vector<Entry>::iterator it = heap.begin(); it != heap.end(); ++it)
+                {
+                    if (metrics.find(it->id) == metrics.end())
+                        left.push_back(it->id);
+                }
+
+                for (std::vector<Guid>::iterator it = left.begin(); it != left.end(); ++it)
+                    RemoveAt(positions[*it]);
+            }
+
+            void ClusterNodeSelector::Remove(const Guid& id)
+            {
+                CsLockGuard guard(lock);
+
+                std::map<Guid, int32_t>::iterator it = positions.find(id);
+
+                if (it != positions.end())
+                    RemoveAt(it->second);
+            }
+
+            bool ClusterNodeSelector::Select(Guid& id, bool expire)
+            {
+                CsLockGuard guard(lock);
+
+                if (heap.empty())
+                    return false;
+
+                // Other snapshots may be as old, but they do not matter until their nodes get to the top.
+                if (expire && maxAge > 0 && GetMonotonicTimeMillis() - heap[0].updateTime > maxAge)
+                    return false;
+
+                id = heap[0].id;
+
+                heap[0].assignedJobs += 1.0;
+                heap[0].load = GetLoad(heap[0]);
+
+                SiftDown(0);
+
+                return true;
+            }
+
+            int32_t ClusterNodeSelector::GetSize()
+            {
+                CsLockGuard guard(lock);
+
+                return static_cast<int32_t>(heap.size());
+            }
+
+            void ClusterNodeSelector::Put(const Guid& id, ClusterMetricsImpl& metrics)
+            {
+                Entry entry;
+
+                entry.id = id;
+                entry.cpuLoad = metrics.GetCurrentCpuLoad();
+                entry.waitingJobs = metrics.GetCurrentWaitingJobs();
+                entry.outboundMessagesQueueSize = metrics.GetOutboundMessagesQueueSize();
+
+                // Jobs assigned before the snapshot are accounted in its metrics.
+                entry.assignedJobs = 0.0;
+
+                int64_t heapMax = metrics.GetHeapMemoryMaximum();
+
+                // Maximum is not defined for some JVM configurations.
+                entry.heapUsage = heapMax > 0 ? static_cast<double>(metrics.GetHeapMemoryUsed()) / heapMax : 0.0;
+
+                entry.load = GetLoad(entry);
+                entry.updateTime = GetMonotonicTimeMillis();
+
+                std::map<Guid, int32_t>::iterator it = positions.find(id);
+
+                if (it == positions.end())
+                {
+                    int32_t pos = static_cast<int32_t>(heap.size());
+
+                    heap.push_back(entry);
+                    positions[id] = pos;
+
+                    SiftUp(pos);
+
+                    return;
+                }
+
+                int32_t pos = it->second;
+                double old = heap[pos].load;
+
+                heap[pos] = entry;
+
+                if (entry.load < old)
+                    SiftUp(pos);
+                else if (entry.load > old)
+                    SiftDown(pos);
+            }
+
+            void ClusterNodeSelector::RemoveAt(int32_t pos)
+            {
+                positions.erase(heap[pos].id);
+
+                int32_t last = static_cast<int32_t>(heap.size()) - 1;
+
+                if (pos != last)
+                {
+                    Entry moved = heap[last];
+
+                    heap.pop_back();
+
+                    Place(pos, moved);
+
+                    SiftUp(pos);
+                    SiftDown(positions[moved.id]);
+                }
+                else
+                    heap.pop_back();
+            }
+
+            double ClusterNodeSelector::GetLoad(const Entry& entry) const
+            {
+                return weights.cpuLoad * entry.cpuLoad +
+                    weights.waitingJobs * entry.waitingJobs +
+                    weights.heapUsage * entry.heapUsage +
+                    weights.outboundMessagesQueueSize * entry.outboundMessagesQueueSize +
+                    weights.assignedJobs * entry.assignedJobs;
+            }
+
+            void ClusterNodeSelector::SiftUp(int32_t pos)
+            {
+                Entry entry = heap[pos];
+
+                while (pos > 0)
+                {
+                    int32_t parent = (pos - 1) / 2;
+
+                    if (heap[parent].load <= entry.load)
+                        break;
+
+                    Place(pos, heap[parent]);
+
+                    pos = parent;
+                }
+
+                Place(pos, entry);
+            }
+
+            void ClusterNodeSelector::SiftDown(int32_t pos)
+            {
+                int32_t size = static_cast<int32_t>(heap.size());
+
+                Entry entry = heap[pos];
+
+                while (true)
+                {
+                    int32_t child = 2 * pos + 1;
+
+                    if (child >= size)
+                        break;
+
+                    if (child + 1 < size && heap[child + 1].load < heap[child].load)
+                        ++child;
+
+                    if (entry.load <= heap[child].load)
+                        break;
+
+                    Place(pos, heap[child]);
+
+                    pos = child;
+                }
+
+                Place(pos, entry);
+            }
+
+            void ClusterNodeSelector::Place(int32_t pos, const Entry& entry)
+            {
+                heap[pos] = entry;
+                positions[entry.id] = pos;
+            }
+        }
+    }
+}
\ No newline at end of file
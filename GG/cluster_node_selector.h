@@ -0,0 +1,229 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _IGNITE_CLUSTER_CLUSTER_NODE_SELECTOR
+#define _IGNITE_CLUSTER_CLUSTER_NODE_SELECTOR
+
+#include <map>
+#include <vector>
+
+#include <ignite/common/concurrent.h>
+#include <ignite/guid.h>
+
+#include <ignite/cluster/cluster_node_load_weights.h>
+
+#include <ignite/impl/cluster/cluster_metrics_impl.h>
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cluster
+        {
+            /**
+             * Selector of the least loaded node.
+             *
+             * Nodes are kept in a binary min-heap ordered by load, so the least loaded
+             * node is found in constant time, and updating the load of a single node,
+             * including the selected one, takes logarithmic time. Raw metrics are kept along with the load, so the
+             * weights can be changed without new snapshots.
+             *
+             * Selected node is charged with an assigned job, which is added to its load
+             * until a new snapshot of the node replaces it. Otherwise all the selections
+             * made between two refreshes would go to the same node.
+             *
+             * Loads expire once the snapshot of the least loaded node is older than the
+             * maximum age. Nothing is selected then until the snapshots are refreshed, so
+             * nodes which have left and charges of jobs which have long completed are not
+             * relied on for longer than that.
+             */
+            class IGNITE_FRIEND_EXPORT ClusterNodeSelector
+            {
+            public:
+                /** Default maximum age of the loads in milliseconds. */
+                enum { DEFAULT_MAX_AGE = 2000 };
+
+                /**
+                 * Constructor.
+                 */
+                ClusterNodeSelector();
+
+                /**
+                 * Set weights of the metrics and recalculate load of all the nodes.
+                 *
+                 * @param weights Weights.
+                 */
+                void SetWeights(const ignite::cluster::ClusterNodeLoadWeights& weights);
+
+                /**
+                 * Get weights of the metrics.
+                 *
+                 * @return Weights.
+                 */
+                ignite::cluster::ClusterNodeLoadWeights GetWeights();
+
+                /**
+                 * Set maximum age of the loads.
+                 *
+                 * @param maxAge Maximum age in milliseconds. Zero or negative value means
+                 *     that loads never expire.
+                 */
+                void SetMaxAge(int64_t maxAge);
+
+                /**
+                 * Get maximum age of the loads.
+                 *
+                 * @return Maximum age in milliseconds.
+                 */
+                int64_t GetMaxAge();
+
+                /**
+                 * Add node or update its load.
+                 *
+                 * @param id Node ID.
+                 * @param metrics Node snapshot.
+                 */
+                void Update(const Guid& id, ClusterMetricsImpl& metrics);
+
+                /**
+                 * Update load of the given nodes and remove all the others.
+                 *
+                 * @param metrics Node snapshots mapped by node ID.
+                 */
+                void Update(const std::map<Guid, SP_ClusterMetricsImpl>& metrics);
+
+                /**
+                 * Remove node.
+                 *
+                 * @param id Node ID.
+                 */
+                void Remove(const Guid& id);
+
+                /**
+                 * Get the least loaded node and charge it with an assigned job.
+                 *
+                 * @param id Node ID.
+                 * @param expire Take the maximum age of the loads into account.
+                 * @return True if there are nodes and their loads have not expired, false
+                 *     otherwise.
+                 */
+                bool Select(Guid& id, bool expire = true);
+
+                /**
+                 * Get number of nodes.
+                 *
+                 * @return Number of nodes.
+                 */
+                int32_t GetSize();
+
+            private:
+                IGNITE_NO_COPY_ASSIGNMENT(ClusterNodeSelector);
+
+                /**
+                 * Node in the heap.
+                 */
+                struct Entry
+                {
+                    /** Node ID. */
+                    Guid id;
+
+                    /** Current CPU load. */
+                    double cpuLoad;
+
+                    /** Current number of waiting jobs. */
+                    double waitingJobs;
+
+                    /** Used to maximum heap memory ratio. */
+                    double heapUsage;
+
+                    /** Outbound messages queue size. */
+                    double outboundMessagesQueueSize;
+
+                    /** Number of selections since the last snapshot. */
+                    double assignedJobs;
+
+                    /** Load. */
+                    double load;
+
+                    /** Time the snapshot was received at, in milliseconds of the monotonic clock. */
+                    int64_t updateTime;
+                };
+
+                /**
+                 * Add node or update its load. Lock should be held.
+                 *
+                 * @param id Node ID.
+                 * @param metrics Node snapshot.
+                 */
+                void Put(const Guid& id, ClusterMetricsImpl& metrics);
+
+                /**
+                 * Remove node at the heap position. Lock should be held.
+                 *
+                 * @param pos Position.
+                 */
+                void RemoveAt(int32_t pos);
+
+                /**
+                 * Calculate load of the node.
+                 *
+                 * @param entry Node.
+                 * @return Load.
+                 */
+                double GetLoad(const Entry& entry) const;
+
+                /**
+                 * Move node towards the root until the heap order is restored.
+                 *
+                 * @param pos Position.
+                 */
+                void SiftUp(int32_t pos);
+
+                /**
+                 * Move node towards the leaves until the heap order is restored.
+                 *
+                 * @param pos Position.
+                 */
+                void SiftDown(int32_t pos);
+
+                /**
+                 * Place node at the heap position.
+                 *
+                 * @param pos Position.
+                 * @param entry Node.
+                 */
+                void Place(int32_t pos, const Entry& entry);
+
+                /** Lock. */
+                common::concurrent::CriticalSection lock;
+
+                /** Weights. */
+                ignite::cluster::ClusterNodeLoadWeights weights;
+
+                /** Maximum age of the loads in milliseconds. */
+                int64_t maxAge;
+
+                /** Nodes ordered by load. */
+                std::vector<Entry> heap;
+
+                /** Heap positions by node ID. */
+                std::map<Guid, int32_t> positions;
+            };
+        }
+    }
+}
+
+#endif //_IGNITE_CLUSTER_CLUSTER_NODE_SELECTOR
\ No newline at end of file
@@ -0,0 +1,443 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <ignite/impl/cluster/compact_cluster_metrics.h>
+
+using namespace ignite::cluster;
+
+namespace
+{
+    /**
+     * Set timestamp from milliseconds.
+     *
+     * @param seconds Seconds part.
+     * @param nanos Nanoseconds part.
+     * @param millis Milliseconds.
+     */
+    void SetTimestamp(int64_t& seconds, int32_t& nanos, double millis)
+    {
+        int64_t ms = static_cast<int64_t>(millis);
+
+        seconds = ms / 1000;
+        nanos = static_cast<int32_t>(ms % 1000) * 1000000;
+    }
+}
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cluster
+        {
+            double CompactClusterMetrics::GetValue(ClusterMetricsField::Type field) const
+            {
+                switch (field)
+                {
+                    case ClusterMetricsField::LAST_UPDATE_TIME_RAW:
+                        return static_cast<double>(hot.lastUpdateTimeRaw);
+
+                    case ClusterMetricsField::LAST_UPDATE_TIME:
+                        return static_cast<double>(GetLastUpdateTime().GetMilliseconds());
+
+                    case ClusterMetricsField::MAXIMUM_ACTIVE_JOBS:
+                        return static_cast<double>(maximumActiveJobs);
+
+                    case ClusterMetricsField::CURRENT_ACTIVE_JOBS:
+                        return static_cast<double>(hot.currentActiveJobs);
+
+                    case ClusterMetricsField::AVERAGE_ACTIVE_JOBS:
+                        return static_cast<double>(averageActiveJobs);
+
+                    case ClusterMetricsField::MAXIMUM_WAITING_JOBS:
+                        return static_cast<double>(maximumWaitingJobs);
+
+                    case ClusterMetricsField::CURRENT_WAITING_JOBS:
+                        return static_cast<double>(hot.currentWaitingJobs);
+
+                    case ClusterMetricsField::AVERAGE_WAITING_JOBS:
+                        return static_cast<double>(averageWaitingJobs);
+
+                    case ClusterMetricsField::MAXIMUM_REJECTED_JOBS:
+                        return static_cast<double>(maximumRejectedJobs);
+
+                    case ClusterMetricsField::CURRENT_REJECTED_JOBS:
+                        return static_cast<double>(hot.currentRejectedJobs);
+
+                    case ClusterMetricsField::AVERAGE_REJECTED_JOBS:
+                        return static_cast<double>(averageRejectedJobs);
+
+                    case ClusterMetricsField::TOTAL_REJECTED_JOBS:
+                        return static_cast<double>(totalRejectedJobs);
+
+                    case ClusterMetricsField::MAXIMUM_CANCELLED_JOBS:
+                        return static_cast<double>(maximumCancelledJobs);
+
+                    case ClusterMetricsField::CURRENT_CANCELLED_JOBS:
+                        return static_cast<double>(currentCancelledJobs);
+
+                    case ClusterMetricsField::AVERAGE_CANCELLED_JOBS:
+                        return static_cast<double>(averageCancelledJobs);
+
+                    case ClusterMetricsField::TOTAL_CANCELLED_JOBS:
+                        return static_cast<double>(totalCancelledJobs);
+
+                    case ClusterMetricsField::TOTAL_EXECUTED_JOBS:
+                        return static_cast<double>(totalExecutedJobs);
+
+                    case ClusterMetricsField::MAXIMUM_JOB_WAIT_TIME:
+                        return static_cast<double>(maximumJobWaitTime);
+
+                    case ClusterMetricsField::CURRENT_JOB_WAIT_TIME:
+                        return static_cast<double>(currentJobWaitTime);
+
+                    case ClusterMetricsField::AVERAGE_JOB_WAIT_TIME:
+                        return static_cast<double>(averageJobWaitTime);
+
+                    case ClusterMetricsField::MAXIMUM_JOB_EXECUTE_TIME:
+                        return static_cast<double>(maximumJobExecuteTime);
+
+                    case ClusterMetricsField::CURRENT_JOB_EXECUTE_TIME:
+                        return static_cast<double>(currentJobExecuteTime);
+
+                    case ClusterMetricsField::AVERAGE_JOB_EXECUTE_TIME:
+                        return static_cast<double>(averageJobExecuteTime);
+
+                    case ClusterMetricsField::TOTAL_EXECUTED_TASKS:
+                        return static_cast<double>(totalExecutedTasks);
+
+                    case ClusterMetricsField::TOTAL_IDLE_TIME:
+                        return static_cast<double>(totalIdleTime);
+
+                    case ClusterMetricsField::CURRENT_IDLE_TIME:
+                        return static_cast<double>(currentIdleTime);
+
+                    case ClusterMetricsField::TOTAL_CPUS:
+                        return static_cast<double>(hot.totalCpus);
+
+                    case ClusterMetricsField::CURRENT_CPU_LOAD:
+                        return static_cast<double>(hot.currentCpuLoad);
+
+                    case ClusterMetricsField::AVERAGE_CPU_LOAD:
+                        return static_cast<double>(averageCpuLoad);
+
+                    case ClusterMetricsField::CURRENT_GC_CPU_LOAD:
+                        return static_cast<double>(hot.currentGcCpuLoad);
+
+                    case ClusterMetricsField::HEAP_MEMORY_INITIALIZED:
+                        return static_cast<double>(heapMemoryInitialized);
+
+                    case ClusterMetricsField::HEAP_MEMORY_USED:
+                        return static_cast<double>(hot.heapMemoryUsed);
+
+                    case ClusterMetricsField::HEAP_MEMORY_COMMITTED:
+                        return static_cast<double>(heapMemoryCommitted);
+
+                    case ClusterMetricsField::HEAP_MEMORY_MAXIMUM:
+                        return static_cast<double>(hot.heapMemoryMaximum);
+
+                    case ClusterMetricsField::HEAP_MEMORY_TOTAL:
+                        return static_cast<double>(heapMemoryTotal);
+
+                    case ClusterMetricsField::NON_HEAP_MEMORY_INITIALIZED:
+                        return static_cast<double>(nonHeapMemoryInitialized);
+
+                    case ClusterMetricsField::NON_HEAP_MEMORY_USED:
+                        return static_cast<double>(nonHeapMemoryUsed);
+
+                    case ClusterMetricsField::NON_HEAP_MEMORY_COMMITTED:
+                        return static_cast<double>(nonHeapMemoryCommitted);
+
+                    case ClusterMetricsField::NON_HEAP_MEMORY_MAXIMUM:
+                        return static_cast<double>(nonHeapMemoryMaximum);
+
+                    case ClusterMetricsField::NON_HEAP_MEMORY_TOTAL:
+                        return static_cast<double>(nonHeapMemoryTotal);
+
+                    case ClusterMetricsField::UPTIME:
+                        return static_cast<double>(uptime);
+
+                    case ClusterMetricsField::START_TIME:
+                        return static_cast<double>(GetStartTime().GetMilliseconds());
+
+                    case ClusterMetricsField::NODE_START_TIME:
+                        return static_cast<double>(GetNodeStartTime().GetMilliseconds());
+
+                    case ClusterMetricsField::CURRENT_THREAD_COUNT:
+                        return static_cast<double>(hot.currentThreadCount);
+
+                    case ClusterMetricsField::MAXIMUM_THREAD_COUNT:
+                        return static_cast<double>(maximumThreadCount);
+
+                    case ClusterMetricsField::TOTAL_STARTED_THREAD_COUNT:
+                        return static_cast<double>(totalStartedThreadCount);
+
+                    case ClusterMetricsField::CURRENT_DAEMON_THREAD_COUNT:
+                        return static_cast<double>(currentDaemonThreadCount);
+
+                    case ClusterMetricsField::LAST_DATA_VERSION:
+                        return static_cast<double>(lastDataVersion);
+
+                    case ClusterMetricsField::SENT_MESSAGES_COUNT:
+                        return static_cast<double>(sentMessagesCount);
+
+                    case ClusterMetricsField::SENT_BYTES_COUNT:
+                        return static_cast<double>(sentBytesCount);
+
+                    case ClusterMetricsField::RECEIVED_MESSAGES_COUNT:
+                        return static_cast<double>(receivedMessagesCount);
+
+                    case ClusterMetricsField::RECEIVED_BYTES_COUNT:
+                        return static_cast<double>(receivedBytesCount);
+
+                    case ClusterMetricsField::OUTBOUND_MESSAGES_QUEUE_SIZE:
+                        return static_cast<double>(hot.outboundMessagesQueueSize);
+
+                    case ClusterMetricsField::TOTAL_NODES:
+                        return static_cast<double>(totalNodes);
+
+                    default:
+                        return 0.0;
+                }
+            }
+
+            void CompactClusterMetrics::SetValue(ClusterMetricsField::Type field, double val)
+            {
+                switch (field)
+                {
+                    case ClusterMetricsField::LAST_UPDATE_TIME_RAW:
+                        hot.lastUpdateTimeRaw = static_cast<int64_t>(val);
+                        break;
+
+                    case ClusterMetricsField::LAST_UPDATE_TIME:
+                        SetTimestamp(lastUpdateTimeSeconds, lastUpdateTimeNanoseconds, val);
+                        break;
+
+                    case ClusterMetricsField::MAXIMUM_ACTIVE_JOBS:
+                        maximumActiveJobs = static_cast<int32_t>(val);
+                        break;
+
+                    case ClusterMetricsField::CURRENT_ACTIVE_JOBS:
+                        hot.currentActiveJobs = static_cast<int32_t>(val);
+                        break;
+
+                    case ClusterMetricsField::AVERAGE_ACTIVE_JOBS:
+                        averageActiveJobs = static_cast<float>(val);
+                        break;
+
+                    case ClusterMetricsField::MAXIMUM_WAITING_JOBS:
+                        maximumWaitingJobs = static_cast<int32_t>(val);
+                        break;
+
+                    case ClusterMetricsField::CURRENT_WAITING_JOBS:
+                        hot.currentWaitingJobs = static_cast<int32_t>(val);
+                        break;
+
+                    case ClusterMetricsField::AVERAGE_WAITING_JOBS:
+                        averageWaitingJobs = static_cast<float>(val);
+                        break;
+
+                    case ClusterMetricsField::MAXIMUM_REJECTED_JOBS:
+                        maximumRejectedJobs = static_cast<int32_t>(val);
+                        break;
+
+                    case ClusterMetricsField::CURRENT_REJECTED_JOBS:
+                        hot.currentRejectedJobs = static_cast<int32_t>(val);
+                        break;
+
+                    case ClusterMetricsField::AVERAGE_REJECTED_JOBS:
+                        averageRejectedJobs = static_cast<float>(val);
+                        break;
+
+                    case ClusterMetricsField::TOTAL_REJECTED_JOBS:
+                        totalRejectedJobs = static_cast<int32_t>(val);
+                        break;
+
+                    case ClusterMetricsField::MAXIMUM_CANCELLED_JOBS:
+                        maximumCancelledJobs = static_cast<int32_t>(val);
+                        break;
+
+                    case ClusterMetricsField::CURRENT_CANCELLED_JOBS:
+                        currentCancelledJobs = static_cast<int32_t>(val);
+                        break;
+
+                    case ClusterMetricsField::AVERAGE_CANCELLED_JOBS:
+                        averageCancelledJobs = static_cast<float>(val);
+                        break;
+
+                    case ClusterMetricsField::TOTAL_CANCELLED_JOBS:
+                        totalCancelledJobs = static_cast<int32_t>(val);
+                        break;
+
+                    case ClusterMetricsField::TOTAL_EXECUTED_JOBS:
+                        totalExecutedJobs = static_cast<int32_t>(val);
+                        break;
+
+                    case ClusterMetricsField::MAXIMUM_JOB_WAIT_TIME:
+                        maximumJobWaitTime = static_cast<int64_t>(val);
+                        break;
+
+                    case ClusterMetricsField::CURRENT_JOB_WAIT_TIME:
+                        currentJobWaitTime = static_cast<int64_t>(val);
+                        break;
+
+                    case ClusterMetricsField::AVERAGE_JOB_WAIT_TIME:
+                        averageJobWaitTime = val;
+                        break;
+
+                    case ClusterMetricsField::MAXIMUM_JOB_EXECUTE_TIME:
+                        maximumJobExecuteTime = static_cast<int64_t>(val);
+                        break;
+
+                    case ClusterMetricsField::CURRENT_JOB_EXECUTE_TIME:
+                        currentJobExecuteTime = static_cast<int64_t>(val);
+                        break;
+
+                    case ClusterMetricsField::AVERAGE_JOB_EXECUTE_TIME:
+                        averageJobExecuteTime = val;
+                        break;
+
+                    case ClusterMetricsField::TOTAL_EXECUTED_TASKS:
+                        totalExecutedTasks = static_cast<int32_t>(val);
+                        break;
+
+                    case ClusterMetricsField::TOTAL_IDLE_TIME:
+                        totalIdleTime = static_cast<int64_t>(val);
+                        break;
+
+                    case ClusterMetricsField::CURRENT_IDLE_TIME:
+                        currentIdleTime = static_cast<int64_t>(val);
+                        break;
+
+                    case ClusterMetricsField::TOTAL_CPUS:
+                        // Sum of the host CPU shares may be off by a rounding error.
+                        hot.totalCpus = static_cast<int32_t>(val + 0.5);
+                        break;
+
+                    case ClusterMetricsField::CURRENT_CPU_LOAD:
+                        hot.currentCpuLoad = val;
+                        break;
+
+                    case ClusterMetricsField::AVERAGE_CPU_LOAD:
+                        averageCpuLoad = val;
+                        break;
+
+                    case ClusterMetricsField::CURRENT_GC_CPU_LOAD:
+                        hot.currentGcCpuLoad = val;
+                        break;
+
+                    case ClusterMetricsField::HEAP_MEMORY_INITIALIZED:
+                        heapMemoryInitialized = static_cast<int64_t>(val);
+                        break;
+
+                    case ClusterMetricsField::HEAP_MEMORY_USED:
+                        hot.heapMemoryUsed = static_cast<int64_t>(val);
+                        break;
+
+                    case ClusterMetricsField::HEAP_MEMORY_COMMITTED:
+                        heapMemoryCommitted = static_cast<int64_t>(val);
+                        break;
+
+                    case ClusterMetricsField::HEAP_MEMORY_MAXIMUM:
+                        hot.heapMemoryMaximum = static_cast<int64_t>(val);
+                        break;
+
+                    case ClusterMetricsField::HEAP_MEMORY_TOTAL:
+                        heapMemoryTotal = static_cast<int64_t>(val);
+                        break;
+
+                    case ClusterMetricsField::NON_HEAP_MEMORY_INITIALIZED:
+                        nonHeapMemoryInitialized = static_cast<int64_t>(val);
+                        break;
+
+                    case ClusterMetricsField::NON_HEAP_MEMORY_USED:
+                        nonHeapMemoryUsed = static_cast<int64_t>(val);
+                        break;
+
+                    case ClusterMetricsField::NON_HEAP_MEMORY_COMMITTED:
+                        nonHeapMemoryCommitted = static_cast<int64_t>(val);
+                        break;
+
+                    case ClusterMetricsField::NON_HEAP_MEMORY_MAXIMUM:
+                        nonHeapMemoryMaximum = static_cast<int64_t>(val);
+                        break;
+
+                    case ClusterMetricsField::NON_HEAP_MEMORY_TOTAL:
+                        nonHeapMemoryTotal = static_cast<int64_t>(val);
+                        break;
+
+                    case ClusterMetricsField::UPTIME:
+                        uptime = static_cast<int64_t>(val);
+                        break;
+
+                    case ClusterMetricsField::START_TIME:
+                        SetTimestamp(startTimeSeconds, startTimeNanoseconds, val);
+                        break;
+
+                    case ClusterMetricsField::NODE_START_TIME:
+                        SetTimestamp(nodeStartTimeSeconds, nodeStartTimeNanoseconds, val);
+                        break;
+
+                    case ClusterMetricsField::CURRENT_THREAD_COUNT:
+                        hot.currentThreadCount = static_cast<int32_t>(val);
+                        break;
+
+                    case ClusterMetricsField::MAXIMUM_THREAD_COUNT:
+                        maximumThreadCount = static_cast<int32_t>(val);
+                        break;
+
+                    case ClusterMetricsField::TOTAL_STARTED_THREAD_COUNT:
+                        totalStartedThreadCount = static_cast<int64_t>(val);
+                        break;
+
+                    case ClusterMetricsField::CURRENT_DAEMON_THREAD_COUNT:
+                        currentDaemonThreadCount = static_cast<int32_t>(val);
+                        break;
+
+                    case ClusterMetricsField::LAST_DATA_VERSION:
+                        lastDataVersion = static_cast<int64_t>(val);
+                        break;
+
+                    case ClusterMetricsField::SENT_MESSAGES_COUNT:
+                        sentMessagesCount = static_cast<int32_t>(val);
+                        break;
+
+                    case ClusterMetricsField::SENT_BYTES_COUNT:
+                        sentBytesCount = static_cast<int64_t>(val);
+                        break;
+
+                    case ClusterMetricsField::RECEIVED_MESSAGES_COUNT:
+                        receivedMessagesCount = static_cast<int32_t>(val);
+                        break;
+
+                    case ClusterMetricsField::RECEIVED_BYTES_COUNT:
+                        receivedBytesCount = static_cast<int64_t>(val);
+                        break;
+
+                    case ClusterMetricsField::OUTBOUND_MESSAGES_QUEUE_SIZE:
+                        hot.outboundMessagesQueueSize = static_cast<int32_t>(val);
+                        break;
+
+                    case ClusterMetricsField::TOTAL_NODES:
+                        totalNodes = static_cast<int32_t>(val);
+                        break;
+
+                    default:
+                        break;
+                }
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,282 @@
+/*
+ * Copyright 2019 GridGain Systems, Inc. and Contributors.
+ *
+ * Licensed under the GridGain Community Edition License (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://www.gridgain.com/products/software/community-edition/gridgain-community-edition-license
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _IGNITE_CLUSTER_COMPACT_CLUSTER_METRICS
+#define _IGNITE_CLUSTER_COMPACT_CLUSTER_METRICS
+
+#include <stdint.h>
+
+#include <ignite/common/common.h>
+#include <ignite/timestamp.h>
+
+#include <ignite/cluster/cluster_metrics_field.h>
+
+namespace ignite
+{
+    namespace impl
+    {
+        namespace cluster
+        {
+            /**
+             * Metrics read on hot paths.
+             *
+             * Fields are ordered by size so the structure has no padding and takes exactly
+             * one cache line.
+             */
+            struct ClusterMetricsSnapshot
+            {
+                /** Last update time of this node metrics in raw format. */
+                int64_t lastUpdateTimeRaw;
+
+                /** Current CPU load. */
+                double currentCpuLoad;
+
+                /** Current GC CPU load. */
+                double currentGcCpuLoad;
+
+                /** Used heap memory. */
+                int64_t heapMemoryUsed;
+
+                /** Maximum heap memory. */
+                int64_t heapMemoryMaximum;
+
+                /** Current active jobs. */
+                int32_t currentActiveJobs;
+
+                /** Current waiting jobs. */
+                int32_t currentWaitingJobs;
+
+                /** Current rejected jobs. */
+                int32_t currentRejectedJobs;
+
+                /** Outbound messages queue size. */
+                int32_t outboundMessagesQueueSize;
+
+                /** Current thread count. */
+                int32_t currentThreadCount;
+
+                /** Total CPUs. */
+                int32_t totalCpus;
+            };
+
+            /**
+             * Compact copy of the cluster metrics snapshot.
+             *
+             * Unlike ClusterMetricsImpl, which keeps the fields in wire order, this structure
+             * is meant to be stored in bulk: the hot load and queue fields come first and fill
+             * the first cache line, the rest are grouped by size to avoid padding between them,
+             * and timestamps are split into plain integers.
+             */
+            struct IGNITE_FRIEND_EXPORT CompactClusterMetrics
+            {
+                /** Hot fields. */
+                ClusterMetricsSnapshot hot;
+
+                /** Last update time of this node metrics, seconds part. */
+                int64_t lastUpdateTimeSeconds;
+
+                /** Maximum time a job ever spent waiting in a queue to be executed. */
+                int64_t maximumJobWaitTime;
+
+                /** Current time an oldest jobs has spent waiting to be executed. */
+                int64_t currentJobWaitTime;
+
+                /** Average time jobs spend waiting in the queue to be executed. */
+                double averageJobWaitTime;
+
+                /** Time it took to execute the longest job on the node. */
+                int64_t maximumJobExecuteTime;
+
+                /** Longest time a current job has been executing for. */
+                int64_t currentJobExecuteTime;
+
+                /** Average time a job takes to execute on the node. */
+                double averageJobExecuteTime;
+
+                /** Total time this node spent idling (not executing any jobs). */
+                int64_t totalIdleTime;
+
+                /** Time this node spend idling since executing last job. */
+                int64_t currentIdleTime;
+
+                /** Average of CPU load values over all metrics kept in the history. */
+                double averageCpuLoad;
+
+                /** The amount of heap memory in bytes that the JVM initially requests from the OS. */
+                int64_t heapMemoryInitialized;
+
+                /** The amount of heap memory in bytes that is committed for the JVM to use. */
+                int64_t heapMemoryCommitted;
+
+                /** The total amount of heap memory in bytes. */
+                int64_t heapMemoryTotal;
+
+                /** The amount of non-heap memory in bytes that the JVM initially requests from the OS. */
+                int64_t nonHeapMemoryInitialized;
+
+                /** The current non-heap memory size that is used by Java VM. */
+                int64_t nonHeapMemoryUsed;
+
+                /** The amount of non-heap memory in bytes that is committed for the JVM to use. */
+                int64_t nonHeapMemoryCommitted;
+
+                /** The maximum amount of non-heap memory in bytes that can be used for memory management. */
+                int64_t nonHeapMemoryMaximum;
+
+                /** The total amount of non-heap memory in bytes that can be used for memory management. */
+                int64_t nonHeapMemoryTotal;
+
+                /** The uptime of the JVM in milliseconds. */
+                int64_t uptime;
+
+                /** Start time of the JVM, seconds part. */
+                int64_t startTimeSeconds;
+
+                /** Start time of grid node, seconds part. */
+                int64_t nodeStartTimeSeconds;
+
+                /** The total number of threads created and also started since the JVM started. */
+                int64_t totalStartedThreadCount;
+
+                /** In-Memory Data Grid assigns incremental versions to all cache operations. */
+                int64_t lastDataVersion;
+
+                /** Sent bytes count. */
+                int64_t sentBytesCount;
+
+                /** Received bytes count. */
+                int64_t receivedBytesCount;
+
+                /** Maximum number of jobs that ever ran concurrently on this node. */
+                int32_t maximumActiveJobs;
+
+                /** Average number of active jobs concurrently executing on the node. */
+                float averageActiveJobs;
+
+                /** Maximum number of waiting jobs this node had. */
+                int32_t maximumWaitingJobs;
+
+                /** Average number of waiting jobs this node had queued. */
+                float averageWaitingJobs;
+
+                /** Maximum number of jobs rejected at once during a single collision resolution operation. */
+                int32_t maximumRejectedJobs;
+
+                /** Average number of jobs this node rejects during collision resolution operations. */
+                float averageRejectedJobs;
+
+                /** Total number of jobs this node rejects during collision resolution operations since node startup. */
+                int32_t totalRejectedJobs;
+
+                /** Maximum number of cancelled jobs this node ever had running concurrently. */
+                int32_t maximumCancelledJobs;
+
+                /** Number of cancelled jobs that are still running. */
+                int32_t currentCancelledJobs;
+
+                /** Average number of cancelled jobs this node ever had running concurrently. */
+                float averageCancelledJobs;
+
+                /** Number of cancelled jobs since node startup. */
+                int32_t totalCancelledJobs;
+
+                /** Total number of jobs handled by the node since node startup. */
+                int32_t totalExecutedJobs;
+
+                /** Total number of tasks handled by the node. */
+                int32_t totalExecutedTasks;
+
+                /** The maximum live thread count since the JVM started or peak was reset. */
+                int32_t maximumThreadCount;
+
+                /** The current number of live daemon threads. */
+                int32_t currentDaemonThreadCount;
+
+                /** Sent messages count. */
+                int32_t sentMessagesCount;
+
+                /** Received messages count. */
+                int32_t receivedMessagesCount;
+
+                /** Total number of nodes. */
+                int32_t totalNodes;
+
+                /** Last update time of this node metrics, fraction of the second in nanoseconds. */
+                int32_t lastUpdateTimeNanoseconds;
+
+                /** Start time of the JVM, fraction of the second in nanoseconds. */
+                int32_t startTimeNanoseconds;
+
+                /** Start time of grid node, fraction of the second in nanoseconds. */
+                int32_t nodeStartTimeNanoseconds;
+
+                /**
+                 * Get last update time.
+                 *
+                 * @return Last update time.
+                 */
+                Timestamp GetLastUpdateTime() const
+                {
+                    return Timestamp(lastUpdateTimeSeconds, lastUpdateTimeNanoseconds);
+                }
+
+                /**
+                 * Get start time.
+                 *
+                 * @return Start time.
+                 */
+                Timestamp GetStartTime() const
+                {
+                    return Timestamp(startTimeSeconds, startTimeNanoseconds);
+                }
+
+                /**
+                 * Get node start time.
+                 *
+                 * @return Node start time.
+                 */
+                Timestamp GetNodeStartTime() const
+                {
+                    return Timestamp(nodeStartTimeSeconds, nodeStartTimeNanoseconds);
+                }
+
+                /**
+                 * Get value of the metric as double.
+                 *
+                 * @param field Metric.
+                 * @return Value. Timestamps are returned in milliseconds.
+                 */
+                double GetValue(ignite::cluster::ClusterMetricsField::Type field) const;
+
+                /**
+                 * Set value of the metric.
+                 *
+                 * @param field Metric.
+                 * @param val Value. Timestamps are given in milliseconds.
+                 */
+                void SetValue(ignite::cluster::ClusterMetricsField::Type field, double val);
+            };
+
+            /** Hot fields must fit exactly one 64-byte cache line. */
+            typedef char ClusterMetricsSnapshotSizeCheck[sizeof(ClusterMetricsSnapshot) == 64 ? 1 : -1];
+
+            /** Compact metrics take 352 bytes: the hot cache line, 284 bytes of the rest and 4 bytes of tail padding. */
+            typedef char CompactClusterMetricsSizeCheck[sizeof(CompactClusterMetrics) == 352 ? 1 : -1];
+        }
+    }
+}
+
+#endif //_IGNITE_CLUSTER_COMPACT_CLUSTER_METRICS
\ No newline at end of file